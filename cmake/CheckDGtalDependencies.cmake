@@ -33,6 +33,13 @@ target_link_libraries(DGtal PUBLIC ZLIB::ZLIB)
 set(DGtalLibInc ${DGtalLibInc} ${ZLIB_INCLUDE_DIRS})
 set(DGtalLibDependencies ${DGtalLibDependencies} ${ZLIB_LIBRARIES})
 
+# -----------------------------------------------------------------------------
+# Looking for threads
+# -----------------------------------------------------------------------------
+find_package(Threads REQUIRED)
+target_link_libraries(DGtal PUBLIC Threads::Threads)
+set(DGtalLibDependencies ${DGtalLibDependencies} ${CMAKE_THREAD_LIBS_INIT})
+
 # -----------------------------------------------------------------------------
 # Setting librt dependency on Linux
 # -----------------------------------------------------------------------------
@@ -0,0 +1,396 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FreemanChainDSSCover.h
+ * @brief Computes the maximal DSS cover of a Freeman chain directly on
+ * its (possibly packed) codes.
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module FreemanChainDSSCover.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testFreemanChainDSSCover.cpp
+ */
+
+#if defined(FreemanChainDSSCover_RECURSES)
+#error Recursive header files inclusion detected in FreemanChainDSSCover.h
+#else // defined(FreemanChainDSSCover_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FreemanChainDSSCover_RECURSES
+
+#if !defined FreemanChainDSSCover_h
+/** Prevents repeated inclusion of headers. */
+#define FreemanChainDSSCover_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FreemanChainDSSCover
+  /**
+   * Description of template class 'FreemanChainDSSCover' <p>
+   * \brief Aim: Computes the tangential cover (i.e. the sequence of
+   * all maximal digital straight segments) of a 4- or 8-connected
+   * Freeman chain, working directly on its codes.
+   *
+   * Contrary to ArithmeticalDSSComputer used within
+   * SaturatedSegmentation, no point is ever built through a generic
+   * iterator: codes are read from a byte buffer (one code per byte)
+   * or from a 2-bits-per-code packed buffer (4-connected chains only),
+   * and the DSS is recognized incrementally with a few integer
+   * operations per step.
+   *
+   * Since a DSS contains at most two distinct codes, which are
+   * consecutive modulo 4 (resp. 8), the recognition is done in a
+   * normalized frame where these codes are mapped onto the steps
+   * (1,0) and (1,1). In this frame, 4-connected (standard) and
+   * 8-connected (naive) DSS share the same update rules for the
+   * characteristics (a,b,μ) and the leaning points (the standard case
+   * is the image of the naive one by the shear (x,y) -> (x+y,y)).
+   * The characteristics of each maximal segment are mapped back to
+   * the chain frame when the segment is output, so that they are
+   * exactly those given by ArithmeticalDSS<Integer,Integer,adjacency>.
+   *
+   * The result is stored as flat arrays indexed by segment number:
+   * index of the first point, index after the last point, a, b and
+   * μ. Points are numbered from 0 (the starting point) to the number
+   * of codes. For closed chains, segments are those of the periodic
+   * chain, sorted by increasing first index in [0,n), and the end
+   * index may exceed n (it must then be taken modulo n).
+   *
+   * Freeman codes are 0:(1,0), 1:(0,1), 2:(-1,0), 3:(0,-1) for
+   * 4-connected chains (as in FreemanChain) and 0:(1,0), 1:(1,1),
+   * 2:(0,1), 3:(-1,1), 4:(-1,0), 5:(-1,-1), 6:(0,-1), 7:(1,-1) for
+   * 8-connected chains.
+   *
+   * @code
+   * FreemanChain<int> fc( "0001000100010001", 0, 0 );
+   * FreemanChainDSSCover<int,4> cover;
+   * cover.computeFromFreemanChain( fc );
+   * for ( unsigned int i = 0; i < cover.size(); ++i )
+   *   trace.info() << cover.begins()[ i ] << " " << cover.ends()[ i ] << " "
+   *                << cover.a()[ i ] << " " << cover.b()[ i ] << std::endl;
+   * @endcode
+   *
+   * @tparam TInteger the type of integers used for coordinates and
+   * characteristics, a model of CInteger.
+   * @tparam adjacency either 4 (standard DSS) or 8 (naive DSS).
+   *
+   * @see ArithmeticalDSS, ArithmeticalDSSComputer, SaturatedSegmentation
+   */
+  template <typename TInteger, unsigned short adjacency = 4>
+  class FreemanChainDSSCover
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CInteger<TInteger> ));
+    BOOST_STATIC_ASSERT(( adjacency == 4 ) || ( adjacency == 8 ));
+
+    // ----------------------- Public types ------------------------------
+  public:
+    typedef FreemanChainDSSCover<TInteger, adjacency> Self;
+    typedef TInteger Integer;
+    typedef PointVector<2, Integer> Point;
+    typedef PointVector<2, Integer> Vector;
+    /// Type of a code stored on one byte (value in [0,4) or [0,8)).
+    typedef DGtal::uint8_t Code;
+    /// Type of a word of a packed chain (32 codes of 2 bits each).
+    typedef DGtal::uint64_t Word;
+    typedef std::size_t Size;
+    typedef std::size_t Index;
+    typedef std::vector<Code> ByteCodes;
+    typedef std::vector<Word> PackedCodes;
+
+    /// Number of codes stored in a Word of a packed chain.
+    BOOST_STATIC_CONSTANT( unsigned int, CODES_PER_WORD = 32 );
+
+    // ----------------------- Standard services ------------------------------
+  public:
+    /**
+     * Constructor. The cover is empty.
+     */
+    FreemanChainDSSCover();
+
+    /**
+     * Destructor.
+     */
+    ~FreemanChainDSSCover() = default;
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    FreemanChainDSSCover( const FreemanChainDSSCover & other ) = default;
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    FreemanChainDSSCover & operator= ( const FreemanChainDSSCover & other ) = default;
+
+    // ----------------------- Conversion services ----------------------------
+  public:
+    /**
+     * Converts the string of a FreemanChain (characters '0' to '3',
+     * or '0' to '7') into one code per byte.
+     *
+     * @param aString a string of Freeman codes.
+     * @return the corresponding codes.
+     */
+    static ByteCodes toByteCodes( const std::string & aString );
+
+    /**
+     * Packs a range of 4-connected codes (values or characters '0'
+     * to '3') with 2 bits per code. Code k is stored in word k/32 at
+     * bits 2*(k%32) and 2*(k%32)+1.
+     *
+     * @tparam TConstIterator a model of forward iterator on codes.
+     * @param itb an iterator on the first code.
+     * @param ite an iterator after the last code.
+     * @return the packed codes.
+     */
+    template <typename TConstIterator>
+    static PackedCodes toPackedCodes( TConstIterator itb, TConstIterator ite );
+
+    /**
+     * @param aCode any Freeman code.
+     * @return the elementary displacement associated to \a aCode.
+     */
+    static Vector displacement( Code aCode );
+
+    // ----------------------- Cover services ----------------------------------
+  public:
+    /**
+     * Computes the tangential cover of the chain starting at \a aStart
+     * and given by one code per byte.
+     *
+     * @param aStart the first point of the chain.
+     * @param aCodes the codes (values in [0,adjacency)).
+     * @param isClosed when 'true', the chain is considered periodic.
+     */
+    void computeFromByteCodes( const Point & aStart,
+                               const ByteCodes & aCodes,
+                               bool isClosed = false );
+
+    /**
+     * Computes the tangential cover of the chain starting at \a
+     * aStart and given by 2-bits packed codes. Only valid for
+     * 4-connected chains.
+     *
+     * @param aStart the first point of the chain.
+     * @param aCodes the packed codes (see toPackedCodes).
+     * @param aNbCodes the number of codes stored in \a aCodes.
+     * @param isClosed when 'true', the chain is considered periodic.
+     */
+    void computeFromPackedCodes( const Point & aStart,
+                                 const PackedCodes & aCodes,
+                                 Size aNbCodes,
+                                 bool isClosed = false );
+
+    /**
+     * Computes the tangential cover of a FreemanChain. Only valid for
+     * 4-connected chains. Codes are read directly from the chain string.
+     *
+     * @param aChain any Freeman chain.
+     * @param isClosed when 'true', the chain is considered periodic.
+     */
+    void computeFromFreemanChain( const FreemanChain<Integer> & aChain,
+                                  bool isClosed = false );
+
+    /**
+     * Clears the cover.
+     */
+    void clear();
+
+    /// @return the number of maximal segments of the cover.
+    Size size() const;
+
+    /// @return the index of the first point of each maximal segment.
+    const std::vector<Index> & begins() const;
+
+    /// @return the index after the last point of each maximal segment.
+    const std::vector<Index> & ends() const;
+
+    /// @return the parameter a of each maximal segment.
+    const std::vector<Integer> & a() const;
+
+    /// @return the parameter b of each maximal segment.
+    const std::vector<Integer> & b() const;
+
+    /// @return the parameter μ (lower bound) of each maximal segment.
+    const std::vector<Integer> & mu() const;
+
+    /**
+     * @param i the index of a maximal segment.
+     * @return its arithmetical thickness ω, i.e. |a|+|b| for
+     * 4-connected chains or max(|a|,|b|) for 8-connected chains.
+     */
+    Integer omega( Index i ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private types ---------------------------------
+  private:
+    /// Reads one code per byte.
+    struct ByteCodeReader
+    {
+      const Code* myCodes;
+      Code operator()( Index k ) const { return myCodes[ k ]; }
+    };
+
+    /// Reads 2-bits packed codes.
+    struct PackedCodeReader
+    {
+      const Word* myWords;
+      Code operator()( Index k ) const
+      {
+        return static_cast<Code>( ( myWords[ k >> 5 ] >> ( ( k & 31 ) << 1 ) ) & 3 );
+      }
+    };
+
+    /// Reads the characters of a FreemanChain string.
+    struct CharCodeReader
+    {
+      const char* myChars;
+      Code operator()( Index k ) const
+      { return static_cast<Code>( myChars[ k ] - '0' ); }
+    };
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// Index of the first point of each maximal segment.
+    std::vector<Index> myBegins;
+    /// Index after the last point of each maximal segment.
+    std::vector<Index> myEnds;
+    /// Parameter a of each maximal segment.
+    std::vector<Integer> myA;
+    /// Parameter b of each maximal segment.
+    std::vector<Integer> myB;
+    /// Parameter μ of each maximal segment.
+    std::vector<Integer> myMu;
+
+    // Recognition state. Coordinates (x,y) are expressed in the
+    // normalized frame, whose origin is the point myOrigin.
+    /// Index of the first point of the current segment.
+    Index myF;
+    /// Index after the last point of the current segment.
+    Index myL;
+    /// First and last points of the current segment in the chain frame.
+    Point myPF, myPL;
+    /// 'true' when the two codes of the current segment are known.
+    bool myIsFramed;
+    /// The code repeated in the current segment when it is not framed.
+    Code myRunCode;
+    /// The codes mapped onto (1,0) and (1,1) in the normalized frame.
+    Code myHCode, myDCode;
+    /// Number of codes myHCode and myDCode in the current segment.
+    Index myNbH, myNbD;
+    /// Origin of the normalized frame in the chain frame.
+    Point myOrigin;
+    /// Characteristics of the current segment in the normalized frame.
+    Integer myNA, myNB, myNMu;
+    /// First and last points of the current segment in the normalized frame.
+    Integer myXf, myYf, myXl, myYl;
+    /// Leaning points of the current segment in the normalized frame.
+    Integer myUfx, myUfy, myUlx, myUly, myLfx, myLfy, myLlx, myLly;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+    /**
+     * Sweeps the chain and fills the flat arrays.
+     * @param aStart the first point of the chain.
+     * @param n the number of codes.
+     * @param isClosed when 'true', the chain is considered periodic.
+     * @param aReader a functor returning the k-th code, k in [0,n).
+     */
+    template <typename TCodeReader>
+    void sweep( const Point & aStart, Size n, bool isClosed,
+                const TCodeReader & aReader );
+
+    /// Starts a new segment made of the single point \a aP of index \a i.
+    void reset( Index i, const Point & aP );
+
+    /**
+     * Extends the current segment with the code \a c.
+     * @return 'true' if the result is a DSS. Otherwise the current
+     * segment is left unchanged.
+     */
+    bool extendFront( Code c );
+
+    /// Removes the first point of the current segment, whose first code is \a c.
+    void retractBack( Code c );
+
+    /// Chooses the normalized frame when a second code \a c appears.
+    void setFrame( Code c );
+
+    /// Appends the current segment to the cover, with first index \a aBegin.
+    void output( Index aBegin );
+
+  }; // end of class FreemanChainDSSCover
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FreemanChainDSSCover'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FreemanChainDSSCover' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TInteger, unsigned short adjacency>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const FreemanChainDSSCover<TInteger, adjacency> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/FreemanChainDSSCover.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FreemanChainDSSCover_h
+
+#undef FreemanChainDSSCover_RECURSES
+#endif // else defined(FreemanChainDSSCover_RECURSES)
@@ -0,0 +1,392 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PackedFreemanChain.h
+ * @brief A 4-connected Freeman chain stored with 2 bits per code.
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module PackedFreemanChain.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testPackedFreemanChain.cpp
+ */
+
+#if defined(PackedFreemanChain_RECURSES)
+#error Recursive header files inclusion detected in PackedFreemanChain.h
+#else // defined(PackedFreemanChain_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedFreemanChain_RECURSES
+
+#if !defined PackedFreemanChain_h
+/** Prevents repeated inclusion of headers. */
+#define PackedFreemanChain_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedFreemanChain
+  /**
+   * Description of template class 'PackedFreemanChain' <p>
+   * \brief Aim: Describes a 4-connected digital curve by its starting
+   * point and its sequence of Freeman codes, stored with 2 bits per
+   * code, i.e. 4 times less memory than FreemanChain.
+   *
+   * Codes are 0:(1,0), 1:(0,1), 2:(-1,0), 3:(0,-1), as in
+   * FreemanChain. Code k is stored in word k/32, at bits 2*(k%32) and
+   * 2*(k%32)+1, which is the layout expected by
+   * FreemanChainDSSCover::computeFromPackedCodes.
+   *
+   * Every 256 codes, the current point is stored as a checkpoint. The
+   * k-th point is then obtained in constant time from the closest
+   * checkpoint before it, by counting the codes of each kind in at
+   * most 8 words with bit masks and population counts, instead of
+   * walking the chain code by code.
+   *
+   * @code
+   * PackedFreemanChain<int> pc( "00101100030", 2, 1 );
+   * PackedFreemanChain<int>::Point p = pc.point( 5 );
+   * for ( auto q : pc ) trace.info() << q << std::endl;
+   * @endcode
+   *
+   * @tparam TInteger the type of the point coordinates, a model of CInteger.
+   *
+   * @see FreemanChain, FreemanChainDSSCover
+   */
+  template <typename TInteger>
+  class PackedFreemanChain
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CInteger<TInteger> ));
+
+    // ----------------------- Public types ------------------------------
+  public:
+    typedef PackedFreemanChain<TInteger> Self;
+    typedef TInteger Integer;
+    typedef PointVector<2, Integer> Point;
+    typedef PointVector<2, Integer> Vector;
+    typedef DGtal::uint64_t Word;
+    typedef std::vector<Word> PackedCodes;
+    typedef std::size_t Size;
+    typedef std::size_t Index;
+
+    /// Number of codes stored in a Word.
+    BOOST_STATIC_CONSTANT( unsigned int, CODES_PER_WORD = 32 );
+    /// Number of words between two checkpoints.
+    BOOST_STATIC_CONSTANT( unsigned int, WORDS_PER_CHECKPOINT = 8 );
+    /// Number of codes between two checkpoints.
+    BOOST_STATIC_CONSTANT( unsigned int,
+                           CODES_PER_CHECKPOINT = CODES_PER_WORD * WORDS_PER_CHECKPOINT );
+
+    /**
+     * Random access iterator on the points of the chain. Incrementing
+     * costs a single code decoding, random displacements cost a
+     * checkpoint lookup. The past-the-end iterator, at index size()+1,
+     * holds the last point, so that no code is decoded when stepping
+     * between indices size() and size()+1.
+     */
+    class ConstIterator
+      : public boost::iterator_facade< ConstIterator, Point const,
+                                       boost::random_access_traversal_tag,
+                                       Point const & >
+    {
+    public:
+      /// Default constructor (invalid iterator).
+      ConstIterator() : myChain( nullptr ), myIndex( 0 ) {}
+      /**
+       * Constructor.
+       * @param aChain the chain.
+       * @param aIndex the index of the pointed point in [0,aChain.size()].
+       */
+      ConstIterator( const PackedFreemanChain & aChain, Index aIndex )
+        : myChain( &aChain ), myIndex( aIndex ),
+          myPoint( aChain.point( std::min( aIndex, aChain.size() ) ) ) {}
+      /// @return the index of the pointed point.
+      Index index() const { return myIndex; }
+      /// @return the code going from the pointed point to the next one.
+      char code() const { return myChain->code( myIndex ); }
+
+    private:
+      friend class boost::iterator_core_access;
+      void increment()
+      {
+        if ( myIndex < myChain->size() )
+          myPoint += displacement( myChain->codeValue( myIndex ) );
+        ++myIndex;
+      }
+      void decrement()
+      {
+        --myIndex;
+        if ( myIndex < myChain->size() )
+          myPoint -= displacement( myChain->codeValue( myIndex ) );
+      }
+      void advance( std::ptrdiff_t n )
+      {
+        myIndex += n;
+        myPoint  = myChain->point( std::min( myIndex, myChain->size() ) );
+      }
+      std::ptrdiff_t distance_to( const ConstIterator & other ) const
+      { return std::ptrdiff_t( other.myIndex ) - std::ptrdiff_t( myIndex ); }
+      bool equal( const ConstIterator & other ) const
+      { return myIndex == other.myIndex; }
+      Point const & dereference() const { return myPoint; }
+
+      const PackedFreemanChain* myChain;
+      Index myIndex;
+      Point myPoint;
+    };
+
+    typedef ConstIterator const_iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+    /**
+     * Constructor of an empty chain starting at (x,y).
+     * @param x the x-coordinate of the first point.
+     * @param y the y-coordinate of the first point.
+     */
+    PackedFreemanChain( Integer x = 0, Integer y = 0 );
+
+    /**
+     * Constructor from a string of codes.
+     * @param s a string of characters '0' to '3'.
+     * @param x the x-coordinate of the first point.
+     * @param y the y-coordinate of the first point.
+     */
+    PackedFreemanChain( const std::string & s, Integer x, Integer y );
+
+    /**
+     * Constructor from a FreemanChain.
+     * @param aChain any 4-connected Freeman chain.
+     */
+    explicit PackedFreemanChain( const FreemanChain<Integer> & aChain );
+
+    /**
+     * Destructor.
+     */
+    ~PackedFreemanChain() = default;
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    PackedFreemanChain( const PackedFreemanChain & other ) = default;
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    PackedFreemanChain & operator= ( const PackedFreemanChain & other ) = default;
+
+    // ----------------------- Building services ------------------------------
+  public:
+    /**
+     * Clears the chain, which becomes a single point (x,y).
+     * @param x the x-coordinate of the first point.
+     * @param y the y-coordinate of the first point.
+     */
+    void clear( Integer x = 0, Integer y = 0 );
+
+    /**
+     * Reserves memory for the given number of codes.
+     * @param n the expected number of codes.
+     */
+    void reserve( Size n );
+
+    /**
+     * Appends a code at the end of the chain.
+     * @param aCode a code value in [0,4).
+     */
+    void pushBack( unsigned int aCode );
+
+    /**
+     * Builds the chain from a range of 4-connected points. Consecutive
+     * points are converted into codes by table lookup.
+     *
+     * @tparam TConstIterator a model of single pass iterator on points.
+     * @param itb an iterator on the first point.
+     * @param ite an iterator after the last point.
+     * @param isClosed when 'true', the code from the last point back
+     * to the first one is appended (e.g. for contours given by
+     * Surfaces::track2DBoundaryPoints).
+     * @throw ConnectivityException if two consecutive points are not
+     * 4-adjacent.
+     */
+    template <typename TConstIterator>
+    void initFromPointsRange( TConstIterator itb, TConstIterator ite,
+                              bool isClosed = false );
+
+    /**
+     * Builds the closed chain of the 2D boundary of a shape, as
+     * Surfaces::track2DBoundaryPoints does, but converting the
+     * pointels into codes on the fly.
+     *
+     * @tparam TKSpace a model of CCellularGridSpaceND of dimension 2.
+     * @tparam TPointPredicate a model of CPointPredicate.
+     * @param K any space of dimension 2.
+     * @param surfel_adj the surfel adjacency chosen for the tracking.
+     * @param pp the point predicate defining the shape.
+     * @param start_surfel a signed surfel between the shape and its complement.
+     */
+    template <typename TKSpace, typename TPointPredicate>
+    void initFromBoundary( const TKSpace & K,
+                           const SurfelAdjacency<2> & surfel_adj,
+                           const TPointPredicate & pp,
+                           const typename TKSpace::SCell & start_surfel );
+
+    /**
+     * @return the corresponding FreemanChain.
+     */
+    FreemanChain<Integer> toFreemanChain() const;
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+    /// @return the number of codes of the chain.
+    Size size() const;
+
+    /// @return the number of bytes used to store the chain.
+    Size memorySize() const;
+
+    /// @return the packed codes (see FreemanChainDSSCover::computeFromPackedCodes).
+    const PackedCodes & words() const;
+
+    /**
+     * @param k an index in [0,size()).
+     * @return the k-th code as a character '0' to '3'.
+     */
+    char code( Index k ) const;
+
+    /**
+     * @param k an index in [0,size()).
+     * @return the k-th code as a value in [0,4).
+     */
+    unsigned int codeValue( Index k ) const;
+
+    /// @return the first point of the chain.
+    Point firstPoint() const;
+
+    /// @return the last point of the chain.
+    Point lastPoint() const;
+
+    /**
+     * Computes the k-th point in constant time.
+     * @param k an index in [0,size()].
+     * @return the k-th point of the chain.
+     */
+    Point point( Index k ) const;
+
+    /// @return an iterator on the first point.
+    ConstIterator begin() const;
+
+    /// @return an iterator after the last point.
+    ConstIterator end() const;
+
+    /**
+     * @param aCode a code value in [0,4).
+     * @return its elementary displacement.
+     */
+    static Vector displacement( unsigned int aCode );
+
+    /**
+     * Counts the codes of each kind among the first codes of a word.
+     * @param w any word.
+     * @param m the number of codes to consider, in [0,32].
+     * @return the displacement made by these codes.
+     */
+    static Vector wordDisplacement( Word w, unsigned int m );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+    /**
+     * @param v any vector.
+     * @return the code of \a v, or -1 if it is not an elementary displacement.
+     */
+    static int codeOf( const Vector & v );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The packed codes.
+    PackedCodes myWords;
+    /// The number of codes.
+    Size mySize;
+    /// The point at index k*CODES_PER_CHECKPOINT, for all k.
+    std::vector<Point> myCheckpoints;
+    /// The last point of the chain.
+    Point myLastPoint;
+
+  }; // end of class PackedFreemanChain
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PackedFreemanChain'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PackedFreemanChain' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TInteger>
+  std::ostream&
+  operator<< ( std::ostream & out, const PackedFreemanChain<TInteger> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/PackedFreemanChain.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedFreemanChain_h
+
+#undef PackedFreemanChain_RECURSES
+#endif // else defined(PackedFreemanChain_RECURSES)
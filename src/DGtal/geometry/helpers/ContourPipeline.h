@@ -0,0 +1,283 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ContourPipeline.h
+ * @brief Extraction of all the contours of a 2D shape by image strips,
+ * and parallel processing of these contours.
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module ContourPipeline.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testContourPipeline.cpp
+ */
+
+#if defined(ContourPipeline_RECURSES)
+#error Recursive header files inclusion detected in ContourPipeline.h
+#else // defined(ContourPipeline_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ContourPipeline_RECURSES
+
+#if !defined ContourPipeline_h
+/** Prevents repeated inclusion of headers. */
+#define ContourPipeline_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ContourPipeline
+  /**
+   * Description of template class 'ContourPipeline' <p>
+   * \brief Aim: Extracts all the contours of a 2D shape and runs
+   * per-contour computations, in parallel when DGtal is built with
+   * OpenMP (WITH_OPENMP).
+   *
+   * The extraction gives exactly the output of
+   * Surfaces::extractAll2DSCellContours and
+   * Surfaces::extractAllPointContours4C (same contours, same starting
+   * surfels, same order), but the image is split into horizontal
+   * strips processed independently. Each strip collects its own
+   * boundary surfels and tracks them into chains, which stop where
+   * the contour leaves the strip. Chains are then stitched at strip
+   * borders, so that each surfel is tracked only once, and each
+   * contour is started after its smallest surfel (closed contours) or
+   * at its first surfel (open contours) as in the sequential version.
+   * Contours are finally sorted by smallest surfel, which is the
+   * sequential order.
+   *
+   * Per-contour computations (e.g. building a GridCurve and running a
+   * MostCenteredMaximalSegmentEstimator or a LambdaMST2D) are
+   * distributed over threads with a dynamic schedule, and their
+   * results are returned in contour order.
+   *
+   * @code
+   * ContourPipeline<Z2i::KSpace> pipeline( K, SurfelAdjacency<2>( true ) );
+   * std::vector< std::vector<Z2i::Point> > contours;
+   * pipeline.extractAllPointContours4C( contours, predicate );
+   * auto lengths = pipeline.apply( contours, [] ( const std::vector<Z2i::Point>& c )
+   *                                { return c.size(); } );
+   * @endcode
+   *
+   * @note The point predicate and the functors given to apply() are
+   * called concurrently and must therefore be thread-safe.
+   *
+   * @tparam TKSpace a model of CCellularGridSpaceND of dimension 2.
+   */
+  template <typename TKSpace>
+  class ContourPipeline
+  {
+    BOOST_STATIC_ASSERT(( TKSpace::dimension == 2 ));
+
+    // ----------------------- Public types ------------------------------
+  public:
+    typedef ContourPipeline<TKSpace> Self;
+    typedef TKSpace KSpace;
+    typedef typename KSpace::Integer Integer;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::SCell SCell;
+    typedef typename KSpace::Cell Cell;
+    typedef std::vector<SCell> SCellContour;
+    typedef std::vector<Point> PointContour;
+    typedef std::size_t Size;
+    /// A contour along with its smallest surfel.
+    typedef std::pair<SCell, SCellContour> KeyedContour;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+    /**
+     * Constructor.
+     *
+     * @param aKSpace the space in which contours are tracked.
+     * @param aSAdj the surfel adjacency chosen for the tracking.
+     * @param nbStrips the number of horizontal strips, or 0 to
+     * choose it from the number of threads.
+     */
+    ContourPipeline( ConstAlias<KSpace> aKSpace,
+                     const SurfelAdjacency<2> & aSAdj,
+                     Size nbStrips = 0 );
+
+    /**
+     * Destructor.
+     */
+    ~ContourPipeline() = default;
+
+    ContourPipeline() = delete;
+    ContourPipeline( const ContourPipeline & other ) = default;
+    ContourPipeline & operator= ( const ContourPipeline & other ) = delete;
+
+    // ----------------------- Extraction services -----------------------------
+  public:
+    /**
+     * Extracts all the contours of the shape as sequences of surfels.
+     * Same output as Surfaces::extractAll2DSCellContours.
+     *
+     * @tparam TPointPredicate a model of concepts::CPointPredicate.
+     * @param[out] aContours the contours.
+     * @param pp the (thread-safe) predicate defining the shape.
+     */
+    template <typename TPointPredicate>
+    void extractAll2DSCellContours( std::vector<SCellContour> & aContours,
+                                    const TPointPredicate & pp ) const;
+
+    /**
+     * Extracts all the contours of the shape as sequences of points.
+     * Same output as Surfaces::extractAllPointContours4C.
+     *
+     * @tparam TPointPredicate a model of concepts::CPointPredicate.
+     * @param[out] aContours the contours.
+     * @param pp the (thread-safe) predicate defining the shape.
+     */
+    template <typename TPointPredicate>
+    void extractAllPointContours4C( std::vector<PointContour> & aContours,
+                                    const TPointPredicate & pp ) const;
+
+    /**
+     * Applies a functor to each contour, in parallel if possible.
+     *
+     * @tparam TContour the type of a contour.
+     * @tparam TFunctor the type of a (thread-safe) functor taking a
+     * contour and returning a default constructible value.
+     * @param aContours the contours.
+     * @param aFunctor the functor.
+     * @return the results, in contour order.
+     */
+    template <typename TContour, typename TFunctor>
+    static
+    std::vector< typename std::decay< typename std::result_of<TFunctor( const TContour & )>::type >::type >
+    apply( const std::vector<TContour> & aContours, const TFunctor & aFunctor );
+
+    /// @return the number of strips.
+    Size nbStrips() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The space in which contours are tracked.
+    const KSpace* myKSpace;
+    /// The surfel adjacency chosen for the tracking.
+    SurfelAdjacency<2> mySAdj;
+    /// The number of horizontal strips.
+    Size myNbStrips;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+    /// A part of contour within one strip, in tracking order.
+    struct Chain
+    {
+      /// The surfels of the chain.
+      SCellContour surfels;
+      /// 'true' iff the chain is a whole contour closed within its strip.
+      bool closed;
+      /// 'true' iff the first surfel has a predecessor.
+      bool hasPrev;
+      /// 'true' iff the last surfel has a successor.
+      bool hasNext;
+      /// the successor of the last surfel, in another strip, if any.
+      SCell next;
+    };
+
+    /**
+     * Tracks the boundary surfels of the strip of rows [y0,y1] into
+     * chains, each surfel being tracked once.
+     * @param[out] aChains the maximal chains of surfels of the strip.
+     * @param pp the predicate defining the shape.
+     * @param y0 the first row of the strip.
+     * @param y1 the last row of the strip.
+     */
+    template <typename TPointPredicate>
+    void extractStrip( std::vector<Chain> & aChains,
+                       const TPointPredicate & pp,
+                       Integer y0, Integer y1 ) const;
+
+    /**
+     * Finds the surfel following or preceding a surfel along its
+     * contour, as Surfaces::track2DBoundary does.
+     * @param SN a surfel neighborhood, initialized in the space.
+     * @param pp the predicate defining the shape.
+     * @param b a boundary surfel.
+     * @param[out] bn the adjacent surfel, if any.
+     * @param forward 'true' for the successor, 'false' for the predecessor.
+     * @return 'true' iff \a b has such an adjacent surfel.
+     */
+    template <typename TPointPredicate>
+    bool adjacent( SurfelNeighborhood<KSpace> & SN,
+                   const TPointPredicate & pp,
+                   const SCell & b, SCell & bn, bool forward ) const;
+
+    /**
+     * @param s a surfel.
+     * @return the row of the spel from which \a s is built by Surfaces::sMakeBoundary.
+     */
+    Integer row( const SCell & s ) const;
+
+  }; // end of class ContourPipeline
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ContourPipeline'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ContourPipeline' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const ContourPipeline<TKSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/helpers/ContourPipeline.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ContourPipeline_h
+
+#undef ContourPipeline_RECURSES
+#endif // else defined(ContourPipeline_RECURSES)
@@ -44,6 +44,7 @@
 // Inclusions
 #include <iostream>
 #include <set>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CInteger.h"
 #include "DGtal/kernel/CSpace.h"
@@ -83,14 +84,29 @@ namespace DGtal
    * points are added to the object. Let \a D be the diameter and \a n
    * be the number of points already added. Assume small
    * integers. Complexity of adding a point that do not change the
-   * normal of the plane is \f$ O(\log(n)) \f$. When it changes the
-   * normal, the number of cuts is upper bounded by some \f$
+   * normal of the plane is \f$ O(\log(n)) \f$ (the insertion in
+   * the set of points, plus an amortized \f$ O(1) \f$ insertion in
+   * the array scanned by the oracle). When
+   * it changes the normal, the number of cuts is upper bounded by some \f$
    * O(\log(D)) \f$, each cut costs \f$ O(n+m\log(D) ) \f$, where \a m
    * is the number of sides of the convex polygon of
    * constraints. However, when recognizing a piece of naive plane,
    * the number of times \a K where the normal should be updated is
    * rather limited to some \f$ O(\log(D)) \f$.
    *
+   * Points are stored contiguously, so that the oracle (the
+   * computation of the min and max dot products with the current
+   * normal) runs on a flat array, along with the set of distinct
+   * points used for iteration and for the detection of duplicates:
+   * each point is thus stored twice. When a
+   * range of points is given to
+   * extend( InputIterator, InputIterator), each iteration of the
+   * algorithm cuts the polygon of constraints not only by the pair of
+   * extremal points but also by the pairs formed with the few highest
+   * and lowest points of the range that exceed the width. These
+   * constraints are sorted by angle before cutting, which reduces the
+   * number of oracle calls.
+   *
    * Note on execution times: The user should favor int64_t instead of
    * BigInteger whenever possible (diameter smaller than 500). The
    * speed-up is between 10 and 20 for these diameters. For greater
@@ -178,6 +194,15 @@ namespace DGtal
       InternalPoint3 N;        /**< current normal vector. */
     };
 
+    /// A point of a range with its dot product with the current normal.
+    typedef std::pair< InternalInteger, Point > ValuedPoint;
+
+    /// A width constraint (gradient, offset) given by a pair of points, as in doubleCut.
+    typedef std::pair< InternalPoint2, InternalInteger > BatchCut;
+
+    /// Number of highest and lowest points of a range kept to cut the polygon of solutions.
+    static const unsigned int NB_BATCH_EXTREMES = 4;
+
     // ----------------------- Standard services ------------------------------
   public:
 
@@ -259,6 +284,8 @@ namespace DGtal
 
     /**
      * @return a const iterator pointing on the first point stored in the current naive plane.
+     * @note Iterators stay valid when the plane is extended (they
+     * run over the set of points).
      */
     ConstIterator begin() const;
 
@@ -456,12 +483,17 @@ namespace DGtal
     InternalInteger myG;       /**< the grid step used in all subsequent computations. */
     InternalPoint2 myWidth;    /**< the plane width as a positive rational number myWidth[0]/myWidth[1] */
     PointSet myPointSet;       /**< the set of points within the plane. */ 
+    std::vector<Point> myPoints; /**< the same points as myPointSet, in insertion order. */
     State myState;             /**< the current state that defines the plane being recognized. */
     InternalInteger myCst1;    /**<  ( (int) ceil( get_si( myG ) * myWidth ) + 1 ). */
     InternalInteger myCst2;    /**<  ( (int) floor( get_si( myG ) * myWidth ) - 1 ). */
     mutable InternalInteger _v;/**< temporary variable used in computations. */
     mutable State _state;      /**< Temporary state used in computations. */
     mutable InternalPoint2 _grad; /**< temporary variable to store the current gradient. */
+    mutable std::vector<Point> _batch; /**< temporary copy of the points of a range. */
+    mutable std::vector<ValuedPoint> _highs; /**< highest points of _batch, by decreasing value. */
+    mutable std::vector<ValuedPoint> _lows;  /**< lowest points of _batch, by increasing value. */
+    mutable std::vector<BatchCut> _cuts;     /**< temporary buffer of batched constraints. */
     // ------------------------- Hidden services ------------------------------
   protected:
 
@@ -494,6 +526,66 @@ namespace DGtal
      */
     void doubleCut( InternalPoint2 & grad, State & state ) const;
 
+    /**
+     * Oracle for ranges: computes the min and max values/arguments of
+     * the scalar product between the normal state.N and the points
+     * of the plane and of _batch, and keeps in _highs and _lows the
+     * points of _batch with highest and lowest scalar products.
+     *
+     * @param state (modified) the state where the normal N is used in
+     * computation and where fields state.min, state.max,
+     * state.ptMin, state.ptMax are updated.
+     */
+    void batchMinMax( State & state ) const;
+
+    /**
+     * Cuts the polygon of solutions state.cip by the constraints
+     * given by the pairs (state.ptMin, q) for q in _highs and (q,
+     * state.ptMax) for q in _lows that exceed the specified width.
+     * The constraints are sorted by the angle of their gradient and
+     * duplicates are removed, so that the polygon is clipped by all
+     * of them in one pass.
+     *
+     * @param state (modified) the state where the fields state.N,
+     * state.min, state.max, state.ptMin, state.ptMax are used in
+     * computation and where field state.cip is updated.
+     */
+    void batchCut( State & state ) const;
+
+    /**
+     * Looks for a plane containing the current points and the points
+     * of _batch.
+     *
+     * @param state (modified) the state that is updated with the
+     * solution when there is one.
+     *
+     * @param newNormal (returns) 'true' if the solution has a new
+     * normal, i.e. the fields state.cip, state.centroid and state.N
+     * are updated, 'false' if only the bounds are updated.
+     *
+     * @return 'true' if there is a solution, 'false' otherwise.
+     */
+    bool batchSolve( State & state, bool & newNormal ) const;
+
+    /**
+     * Copies in _batch the points of the range [\a it, \a itE), so
+     * that they can be scanned several times whatever the kind of
+     * iterator.
+     *
+     * @tparam TInputIterator any model of InputIterator on Point.
+     * @param it an iterator on the first element of the range of 3D points.
+     * @param itE an iterator after the last element of the range of 3D points.
+     */
+    template <typename TInputIterator>
+    void fillBatch( TInputIterator it, TInputIterator itE ) const;
+
+    /**
+     * Adds a point to the set of points and to myPoints, unless it is
+     * already there.
+     * @param p any 3D point.
+     */
+    void addPoint( const Point & p );
+
     /**
      * Computes the min and max values/arguments of the scalar product
      * between the normal state.N and the points in the range
@@ -45,6 +45,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/math/linalg/SimpleMatrix.h"
@@ -869,6 +871,12 @@ public:
    *
    * Stores the full kernel explicitly: choose this init if you have a lot of memory or if your kernel is small
    *
+   * @note In 3D, the kernel is read once here and stored as runs of
+   * spels along the first axis, together with the six masks of the
+   * spels entering or leaving the kernel when it moves by one spel
+   * along an axis (see initKernelRuns). The given \a masks are kept
+   * for compatibility but are not used.
+   *
    * @param[in] pOrigin center (digital point) of the kernel support.
    * @param[in] fullKernel pair of iterators of the full kernel. first is the first iterator (of spel) of the kernel support, second is the last iterator (of spel, excluded).
    * @param[in] masks Vector of iterators (of spel) of the first and last spel of each masks. They must be ordered using a trit ({0,1,2}) encoded array.
@@ -888,6 +896,10 @@ public:
   *
   * Stores the kernel implicitly: choose this init if you have not a lot of memory available or if your kernel size is big.
   *
+  * @note In 3D, the domain of \a fullKernel is scanned once here to
+  * build the runs and difference masks of the kernel, as in the other
+  * init method. The given \a masks are not used.
+  *
   * @param[in] pOrigin center (digital point) of the kernel support.
   * @param[in] fullKernel pointer of the digital (full) kernel.
   * @param[in] masks Vector of iterators (of spel) of the first and last spel of each masks. They must be ordered using a trit ({0,1,2}) encoded array.
@@ -934,6 +946,10 @@ public:
   /**
   * Convolve the kernel at all positions of the range [itBegin, itEnd[ and outputs results sequentially with \a result iterator.
   *
+  * Surfels are visited in Morton order of their inner spel, so that the
+  * kernel mostly slides by one spel from a surfel to the next one
+  * (see spatialOrder), while results are output in the order of the range.
+  *
   * @param[in] itbegin (iterator of the) first surfel of the shape where the convolution is computed.
   * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the convolution is computed.
   * @param[out] result iterator of an array where estimates quantities are set ( the estimated quantity from *itbegin till *itend (excluded)).
@@ -1085,6 +1101,8 @@ protected:
    * @param[in] lastInnerSum last Quantity when centering with inner spel. Set empty if useLastResults is false.
    * @param[in] lastOuterSum last Quantity when centering with outer spel. Set empty if useLastResults is false.
    *
+   * @return 'true' if the kernel was fully evaluated at the inner spel, 'false' if it slid from the last results.
+   *
    * @tparam SurfelIterator type of iterator on surfel
    */
   template< typename SurfelIterator >
@@ -1109,6 +1127,8 @@ protected:
    * @param[in,out] lastInnerMoments last inner moments when centering with inner spel. Override at end of function with current inner moments (from surfel *it). Set empty if useLastResults is false.
    * @param[in,out] lastOuterMoments last inner moments when centering with inner spel. Override at end of function with current outer moments (from surfel *it). Set empty if useLastResults is false.
    *
+   * @return 'true' if the kernel was fully evaluated at the inner spel, 'false' if it slid from the last results.
+   *
    * @tparam SurfelIterator type of iterator on surfel
    */
   template< typename SurfelIterator >
@@ -1121,6 +1141,123 @@ protected:
                                    Quantity * lastInnerMoments = defaultInnerMoments,
                                    Quantity * lastOuterMoments = defaultOuterMoments ) const;
 
+  /// A run of consecutive kernel spels along the first axis.
+  struct KernelRun
+  {
+    Point first;       ///< Khalimsky coordinates of the first spel of the run.
+    Dimension length;  ///< Number of spels of the run.
+  };
+
+  /// Sums the spels of the kernel that belong to the shape.
+  struct VolumeAccumulator
+  {
+    Quantity sum;
+    void clear() { sum = NumberTraits< Quantity >::ZERO; }
+    void operator() ( const Spel &, Quantity direction ) { sum += direction; }
+  };
+
+  /// Sums the moments of the spels of the kernel that belong to the shape.
+  struct MomentsAccumulator
+  {
+    const DigitalSurfaceConvolver * convolver;
+    Quantity moments[ 10 ];
+    void clear() { std::fill( moments, moments + 10, NumberTraits< Quantity >::ZERO ); }
+    void operator() ( const Spel & aSpel, Quantity direction )
+    { convolver->fillMoments( moments, aSpel, direction ); }
+  };
+
+  /**
+   * Builds the runs of the kernel along the first axis and its six
+   * difference masks: myDifferenceMasks[ 2k ] holds the kernel spels
+   * whose predecessor along axis k is not in the kernel, and
+   * myDifferenceMasks[ 2k+1 ] those whose successor is not in the kernel.
+   *
+   * @param[in] kernelSpels the Khalimsky coordinates of the kernel spels.
+   */
+  void initKernelRuns ( std::vector< Point > kernelSpels );
+
+  /**
+   * Calls \a accumulator( spel, direction ) for each spel of the shape
+   * among the given spels, once translated by \a shift.
+   *
+   * @param[in,out] accumulator the accumulator.
+   * @param[in] spels the Khalimsky coordinates of the spels.
+   * @param[in] shift the translation applied to the spels.
+   * @param[in] direction 1 to add the spels, -1 to remove them.
+   */
+  template< typename Accumulator >
+  void accumulateSpels ( Accumulator & accumulator,
+                         const std::vector< Point > & spels,
+                         const Point & shift,
+                         Quantity direction ) const;
+
+  /**
+   * Calls \a accumulator( spel, 1 ) for each spel of the shape in the
+   * kernel translated by \a shift, by walking through the kernel runs.
+   *
+   * @param[in,out] accumulator the accumulator.
+   * @param[in] shift the translation applied to the kernel.
+   */
+  template< typename Accumulator >
+  void accumulateKernel ( Accumulator & accumulator, const Point & shift ) const;
+
+  /**
+   * Updates \a accumulator from the kernel translated by \a from to the
+   * kernel translated by \a to, with unit moves along each axis that
+   * only visit the difference masks.
+   *
+   * @param[in,out] accumulator the accumulator, valid at \a from.
+   * @param[in] from the current translation of the kernel.
+   * @param[in] to the new translation of the kernel.
+   */
+  template< typename Accumulator >
+  void slideKernel ( Accumulator & accumulator, Point from, const Point & to ) const;
+
+  /**
+   * @param[in] from a translation of the kernel.
+   * @param[in] to another translation of the kernel.
+   * @return the number of spels visited by slideKernel( ., from, to ).
+   */
+  std::size_t slidingCost ( const Point & from, const Point & to ) const;
+
+  /**
+   * Accumulates the kernel centered on the inner and outer spels of \a
+   * aSurfel, starting from the last results if sliding is cheaper than
+   * a full evaluation of the kernel.
+   *
+   * @param[in] aSurfel the surfel.
+   * @param[in,out] inner the accumulator of the inner spel, valid at \a lastInnerSpel if \a useLastResults.
+   * @param[in,out] outer the accumulator of the outer spel, valid at \a lastOuterSpel if \a useLastResults.
+   * @param[in] useLastResults if we can use last results.
+   * @param[in,out] lastInnerSpel last inner spel, set to the inner spel of \a aSurfel.
+   * @param[in,out] lastOuterSpel last outer spel, set to the outer spel of \a aSurfel.
+   *
+   * @return 'true' if the kernel was fully evaluated, 'false' if it slid.
+   */
+  template< typename Accumulator >
+  bool core_accumulate ( const Spel & aSurfel,
+                         Accumulator & inner,
+                         Accumulator & outer,
+                         bool useLastResults,
+                         Spel & lastInnerSpel,
+                         Spel & lastOuterSpel ) const;
+
+  /**
+   * Copies the surfels of [itbegin, itend[ into \a surfels and computes
+   * in \a order their indices sorted along the Morton (Z-order) curve
+   * of their inner spels.
+   *
+   * @param[in] itbegin (iterator of the) first surfel.
+   * @param[in] itend (iterator of the) last (excluded) surfel.
+   * @param[out] surfels the surfels, in the order of the range.
+   * @param[out] order the indices of the surfels in Morton order.
+   */
+  template< typename SurfelIterator >
+  void spatialOrder ( const SurfelIterator & itbegin,
+                      const SurfelIterator & itend,
+                      std::vector< Spel > & surfels,
+                      std::vector< std::size_t > & order ) const;
+
 
   // ------------------------- Private Datas --------------------------------
 
@@ -1148,6 +1285,12 @@ private:
 
   Spel myKernelSpelOrigin; ///< Copy of the origin cell of the kernel.
 
+  std::vector< KernelRun > myKernelRuns; ///< Spels of the kernel, as runs along the first axis.
+
+  std::vector< std::vector< Point > > myDifferenceMasks; ///< Spels entering or leaving the kernel on unit moves. See initKernelRuns().
+
+  std::size_t myKernelSize; ///< Number of spels of the kernel.
+
   // ------------------------- Hidden services ------------------------------
 
 protected:
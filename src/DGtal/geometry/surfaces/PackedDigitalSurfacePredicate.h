@@ -0,0 +1,234 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module PackedDigitalSurfacePredicate.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PackedDigitalSurfacePredicate_RECURSES)
+#error Recursive header files inclusion detected in PackedDigitalSurfacePredicate.h
+#else // defined(PackedDigitalSurfacePredicate_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedDigitalSurfacePredicate_RECURSES
+
+#if !defined PackedDigitalSurfacePredicate_h
+/** Prevents repeated inclusion of headers. */
+#define PackedDigitalSurfacePredicate_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <cstdint>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedDigitalSurfacePredicate
+  /**
+   * Description of template class 'PackedDigitalSurfacePredicate' <p>
+   * \brief Aim: A point predicate which tells whether a point belongs to the
+   * set of pointels of a given digital surface or not, like
+   * DigitalSurfacePredicate, but with the pointels stored as one bit per
+   * point of their bounding box.
+   *
+   * A query is then a bound check and a bit test. The bit array is
+   * shared (and never modified) by all the copies of a predicate, so
+   * copies are cheap and may be queried concurrently.
+   *
+   * A copy can moreover record its queries and their answers in a
+   * query log (see setQueryLog). PlaneProbingDigitalSurfaceLocalEstimator::evalBatch
+   * uses it to decide whether a plane-probing run can be reused on a
+   * translated frame.
+   *
+   * @tparam TSurface any digital surface type.
+   *
+     \b Models: A PackedDigitalSurfacePredicate is a model of concepts::CPointPredicate.
+   */
+  template <typename TSurface>
+  class PackedDigitalSurfacePredicate
+  {
+    // ----------------------- Public types ------------------------------
+  public:
+      using Surface  = TSurface;
+      using Point    = typename Surface::Point;
+      using Integer  = typename Point::Coordinate;
+      using KSpace   = typename Surface::KSpace;
+      using Word     = uint64_t;
+      using QueryLog = std::vector< std::pair<Point, bool> >;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor. The predicate is false everywhere.
+     */
+    PackedDigitalSurfacePredicate();
+
+    /**
+     * Constructor.
+     *
+     * @param aSurface a digital surface.
+     */
+    PackedDigitalSurfacePredicate(ConstAlias<Surface> aSurface);
+
+    /**
+     * Copy constructor. The bits are shared, the query log is not.
+     * @param other the object to clone.
+     */
+    PackedDigitalSurfacePredicate ( const PackedDigitalSurfacePredicate & other );
+
+    /**
+     * Copy assignment operator. The bits are shared, the query log is not.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    PackedDigitalSurfacePredicate & operator= ( const PackedDigitalSurfacePredicate & other );
+
+    /**
+     * Destructor.
+     */
+    ~PackedDigitalSurfacePredicate() = default;
+
+    //-------------------- model of concepts::CPointPredicate -----------------------------
+  public:
+    /**
+     * Test whether a point is a pointel of a digital surface or not.
+     *
+     * @param aPoint any digital point.
+     * @return 'true' if the point is a pointel of the digital surface, false otherwise.
+     */
+    bool operator() (Point const& aPoint) const;
+
+    // ----------------------- Query log services --------------------------------
+  public:
+    /**
+     * Makes this predicate append each query and its answer to a log
+     * (or stop logging if \a aLog is null).
+     *
+     * @param aLog a pointer on a query log, or nullptr.
+     */
+    void setQueryLog (QueryLog* aLog);
+
+    /**
+     * @return the current query log, or nullptr.
+     */
+    QueryLog* queryLog () const;
+
+    /**
+     * Checks that the queries of a log have the same answers once
+     * translated. Nothing is logged.
+     *
+     * @param aLog a query log.
+     * @param aTranslation a translation vector.
+     * @return 'true' if the answer of each query q is also the answer
+     * for q + aTranslation.
+     */
+    bool isTranslationInvariant (QueryLog const& aLog, Point const& aTranslation) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the lowest point of the bounding box of the pointels.
+     */
+    Point const& lowerBound () const;
+
+    /**
+     * @return the uppermost point of the bounding box of the pointels.
+     */
+    Point const& upperBound () const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    Point myLower; /**< The lowest point of the bounding box. */
+    Point myUpper; /**< The uppermost point of the bounding box. */
+    std::shared_ptr< const std::vector<Word> > myBits; /**< One bit per point of the bounding box, shared by copies. */
+    QueryLog* myLog; /**< The query log, if any. */
+
+    // ------------------------- Internals ------------------------------------
+  private:
+    /**
+     * @param aPoint any digital point.
+     * @return the membership bit of \a aPoint, without logging.
+     */
+    bool test (Point const& aPoint) const;
+
+    /**
+     * @param aPoint a point of the bounding box.
+     * @return the index of its bit.
+     */
+    std::size_t index (Point const& aPoint) const;
+
+    /**
+     * Computes the bounding box of the pointels and their bits.
+     *
+     * @param aSurface a digital surface.
+     */
+    void buildBits (Surface const& aSurface);
+
+  }; // end of class PackedDigitalSurfacePredicate
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PackedDigitalSurfacePredicate'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PackedDigitalSurfacePredicate' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSurface>
+  std::ostream&
+  operator<< ( std::ostream & out, const PackedDigitalSurfacePredicate<TSurface> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/PackedDigitalSurfacePredicate.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedDigitalSurfacePredicate_h
+
+#undef PackedDigitalSurfacePredicate_RECURSES
+#endif // else defined(PackedDigitalSurfacePredicate_RECURSES)
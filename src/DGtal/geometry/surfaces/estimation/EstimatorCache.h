@@ -66,6 +66,9 @@ namespace DGtal
    *
    * This class is also a model of concepts::CSurfelLocalEstimator
    *
+   * @see IndexedEstimatorCache for a cache in flat arrays, indexed by
+   * the order of the surfels and filled with the range eval.
+   *
    * @see testEstimatorCache.cpp
 
    * @tparam TEstimator any model of CSurfelLocalEstimator
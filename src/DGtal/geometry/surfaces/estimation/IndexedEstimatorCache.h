@@ -0,0 +1,449 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file IndexedEstimatorCache.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module IndexedEstimatorCache.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(IndexedEstimatorCache_RECURSES)
+#error Recursive header files inclusion detected in IndexedEstimatorCache.h
+#else // defined(IndexedEstimatorCache_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define IndexedEstimatorCache_RECURSES
+
+#if !defined IndexedEstimatorCache_h
+/** Prevents repeated inclusion of headers. */
+#define IndexedEstimatorCache_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <functional>
+#include <algorithm>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Alias.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
+#include "DGtal/geometry/surfaces/estimation/CSurfelLocalEstimator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class IndexedEstimatorCache
+  /**
+   * Description of template class 'IndexedEstimatorCache' <p>
+   * \brief Aim: this class adapts any local surface estimator to cache the
+   * estimated values in flat arrays aligned with the order of the
+   * surfels given at initialization.
+   *
+   * As EstimatorCache, it is meant to estimate a quantity once and to
+   * query it many times. Surfels and quantities are stored in two
+   * vectors, so that the \a i-th surfel of the range given to init() has
+   * its value at slot \a i: with an indexed surface (e.g. the surfel
+   * range of an IndexedDigitalSurface or of Shortcuts), value(i) is a
+   * simple array access. Queries by surfel go through an open-addressing
+   * hash table (linear probing) of surfel indices, instead of the tree
+   * lookup of the default std::map of EstimatorCache.
+   *
+   * The values are computed with the range eval() of the estimator on
+   * the stored surfels, which lets estimators reuse their computations
+   * between consecutive surfels. If the estimator is thread-safe (its
+   * const eval() methods may run concurrently), the fill can be split
+   * into chunks of surfels evaluated in parallel (with OpenMP).
+   *
+   * This class is also a model of concepts::CSurfelLocalEstimator
+   *
+   * @see testEstimatorCache.cpp
+   *
+   * @tparam TEstimator any model of CSurfelLocalEstimator
+   */
+  template <typename TEstimator>
+  class IndexedEstimatorCache
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    ///Estimator type
+    typedef TEstimator Estimator;
+    BOOST_CONCEPT_ASSERT(( concepts::CSurfelLocalEstimator<TEstimator> ));
+
+    ///Surfel type
+    typedef typename Estimator::Surfel Surfel;
+
+    ///Quantity type
+    typedef typename Estimator::Quantity Quantity;
+
+    ///Index of a surfel in the cache
+    typedef std::size_t Index;
+
+    ///Surfels in the order of the cache
+    typedef std::vector<Surfel> Surfels;
+
+    ///Cached quantities, aligned with the surfels
+    typedef std::vector<Quantity> Quantities;
+
+    ///Self
+    typedef IndexedEstimatorCache<Estimator> Self;
+
+    /**
+     * Default constructor.
+     */
+    IndexedEstimatorCache(): myEstimator(0), myParallelFill(false),
+                             myInit(false)
+    {}
+
+    /**
+     * Constructor from estimator instance.
+     *
+     * @param anEstimator the estimator whose values are cached.
+     * @param parallelFill when 'true', init() evaluates chunks of
+     * surfels in parallel: only use it if the const eval() methods of
+     * the estimator are thread-safe.
+     */
+    IndexedEstimatorCache( Alias<Estimator> anEstimator, bool parallelFill = false )
+      : myEstimator(&anEstimator), myParallelFill(parallelFill), myInit(false)
+    {}
+
+    /**
+     * Destructor.
+     */
+    ~IndexedEstimatorCache()
+    {}
+
+    /**
+     * Copy constructor.
+     */
+    IndexedEstimatorCache(const Self &other): mySurfels(other.mySurfels),
+                                              myValues(other.myValues),
+                                              mySlots(other.mySlots),
+                                              myEstimator(other.myEstimator),
+                                              myParallelFill(other.myParallelFill),
+                                              myInit(other.myInit)
+    {}
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    Self & operator= ( const Self & other )
+    {
+      mySurfels = other.mySurfels;
+      myValues = other.myValues;
+      mySlots = other.mySlots;
+      myEstimator = other.myEstimator;
+      myParallelFill = other.myParallelFill;
+      myInit = other.myInit;
+
+      return *this;
+    }
+
+    // ----------------------- CSurfelLocalEstimator Interface --------------------------------------
+
+    /**
+     * Estimator initialization. This method copies the surfels between
+     * @a itb and @a ite, initializes the underlying estimator on them
+     * and caches their estimated quantities, in the same order.
+     *
+     * @tparam  SurfelConstIterator a const iterator on surfels.
+     * @param[in] aH the gridstep
+     * @param[in] itb iterator on the first surfel of the surface.
+     * @param[in] ite iterator after the last surfel of the surface.
+     *
+     */
+    template <typename SurfelConstIterator>
+    void init(const double aH, SurfelConstIterator itb, SurfelConstIterator ite)
+    {
+      ASSERT(myEstimator);
+      mySurfels.clear();
+      for(SurfelConstIterator it = itb; it != ite; ++it)
+        mySurfels.push_back( *it );
+
+      myEstimator->init( aH, mySurfels.cbegin(), mySurfels.cend() );
+      fill();
+      buildSlots();
+
+      myInit = true;
+    }
+
+    /**
+     * Cached evaluation of the estimator at iterator @a it
+     *
+     * @pre init() method must have been called first.
+     *
+     * @tparam  SurfelConstIterator a const iterator on surfels.
+     * @param [in] it the iterator to the surfel to estimate.
+     * @return the estimated quantity.
+     * @throw InputException if the surfel is not cached.
+     */
+    template <typename SurfelConstIterator>
+    Quantity eval(const SurfelConstIterator it) const
+    {
+      return eval( Surfel( *it ) );
+    }
+
+    /**
+     * Cached evaluation of the estimator at a surfel @a s
+     *
+     * @pre init() method must have been called first.
+     *
+     * @param [in] s the surfel to estimate.
+     * @return the estimated quantity.
+     * @throw InputException if the surfel is not cached.
+     */
+    Quantity eval(const Surfel s) const
+    {
+      ASSERT_MSG(myInit, " init() method must have been called first.");
+      const Index i = index( s );
+      if ( i >= size() )
+        {
+          trace.error() << "[IndexedEstimatorCache::eval] the surfel " << s
+                        << " is not in the cache." << std::endl;
+          throw InputException();
+        }
+      return myValues[ i ];
+    }
+
+    /**
+     * Cached range evaluation of the estimator between @a itb
+     * and @a ite.
+     *
+     * @pre init() method must have been called first.
+     *
+     * @tparam  SurfelConstIterator a const iterator on surfels.
+     * @param [in] itb the begin iterator to the surfel to estimate.
+     * @param [in] ite the end iterator to the surfel to estimate.
+     * @param [in] result an output iterator on the result.
+     * @return the estimated quantity.
+     * @throw InputException if a surfel is not cached.
+     */
+    template <typename SurfelConstIterator,typename OutputIterator>
+    OutputIterator eval(SurfelConstIterator itb,
+                        SurfelConstIterator ite,
+                        OutputIterator result ) const
+    {
+      ASSERT_MSG(myInit, " init() method must have been called first.");
+      for(SurfelConstIterator it = itb; it != ite; ++it)
+        *result++ = this->eval(it);
+
+      return result;
+    }
+
+    /**
+     * @return the gridstep.
+     *
+     * @pre init() method must have been called first.
+     */
+    double h() const
+    {
+      return myEstimator->h();
+    }
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @pre init() method must have been called first.
+     * @return the number of cached elements.
+     */
+    Index size() const
+    {
+      ASSERT_MSG(myInit, " init() method must have been called first.");
+      return myValues.size();
+    }
+
+    /**
+     * @param [in] s any surfel.
+     * @return the index of @a s in the cache (the position of its first
+     * occurrence in the range given to init()), or size() if @a s is not
+     * cached.
+     */
+    Index index( const Surfel & s ) const
+    {
+      if ( mySlots.empty() ) return mySurfels.size();
+      const Index mask = mySlots.size() - 1;
+      for ( Index slot = hashSlot( s ); ; slot = ( slot + 1 ) & mask )
+        {
+          const Index i = mySlots[ slot ];
+          if ( i == 0 ) return mySurfels.size();
+          if ( mySurfels[ i - 1 ] == s ) return i - 1;
+        }
+    }
+
+    /**
+     * @pre init() method must have been called first and i < size().
+     * @param [in] i the index of a cached surfel.
+     * @return the cached quantity of the \a i-th surfel.
+     */
+    Quantity value( const Index i ) const
+    {
+      ASSERT_MSG(myInit, " init() method must have been called first.");
+      ASSERT( i < myValues.size() );
+      return myValues[ i ];
+    }
+
+    /// @return the cached surfels, in the order given to init().
+    const Surfels & surfels() const
+    {
+      return mySurfels;
+    }
+
+    /// @return the cached quantities, aligned with surfels().
+    const Quantities & values() const
+    {
+      return myValues;
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const
+    {
+      out<< "[IndexedEstimatorCache] number of surfels="<<myValues.size()
+         << " slots="<<mySlots.size();
+    }
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const
+    {
+      return myEstimator && myEstimator->isValid()
+        && myValues.size() == mySurfels.size();
+    }
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    ///Cached surfels, in the order given to init()
+    Surfels mySurfels;
+
+    ///Cached quantities, aligned with mySurfels
+    Quantities myValues;
+
+    ///Open-addressing table of surfel indices plus one (0 is an empty slot)
+    std::vector<Index> mySlots;
+
+    ///Alias of the estimator
+    Estimator *myEstimator;
+
+    ///When 'true', the cache is filled in parallel
+    bool myParallelFill;
+
+    ///Init flag
+    bool myInit;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Evaluates the estimator on mySurfels, by chunks in parallel if
+     * myParallelFill is set and OpenMP is available.
+     */
+    void fill()
+    {
+      const Index n = mySurfels.size();
+      myValues.resize( n );
+      if ( n == 0 ) return;
+#ifdef WITH_OPENMP
+      if ( myParallelFill )
+        {
+          const Index chunks = std::min( n, 4 * (Index) omp_get_max_threads() );
+#pragma omp parallel for schedule(dynamic, 1)
+          for ( long c = 0; c < (long) chunks; ++c )
+            {
+              const Index b = n * c / chunks;
+              const Index e = n * ( c + 1 ) / chunks;
+              myEstimator->eval( mySurfels.cbegin() + b, mySurfels.cbegin() + e,
+                                 myValues.begin() + b );
+            }
+          return;
+        }
+#endif
+      myEstimator->eval( mySurfels.cbegin(), mySurfels.cend(), myValues.begin() );
+    }
+
+    /**
+     * Builds the hash table of mySurfels, with a power of two capacity
+     * that keeps its load factor at most 1/2.
+     */
+    void buildSlots()
+    {
+      Index capacity = 2;
+      while ( capacity < 2 * mySurfels.size() ) capacity *= 2;
+      mySlots.assign( capacity, 0 );
+      const Index mask = capacity - 1;
+      for ( Index i = 0; i < mySurfels.size(); ++i )
+        for ( Index slot = hashSlot( mySurfels[ i ] ); ; slot = ( slot + 1 ) & mask )
+          {
+            if ( mySlots[ slot ] == 0 ) { mySlots[ slot ] = i + 1; break; }
+            if ( mySurfels[ mySlots[ slot ] - 1 ] == mySurfels[ i ] ) break;
+          }
+    }
+
+    /**
+     * @param [in] s any surfel.
+     * @return the first slot of @a s in the hash table: the hash of @a s
+     * is scrambled by a Fibonacci multiplication so that its low bits
+     * spread well.
+     */
+    Index hashSlot( const Surfel & s ) const
+    {
+      const DGtal::uint64_t h = static_cast<DGtal::uint64_t>( std::hash<Surfel>()( s ) )
+        * static_cast<DGtal::uint64_t>( 0x9E3779B97F4A7C15ULL );
+      return static_cast<Index>( h >> 32 ) & ( mySlots.size() - 1 );
+    }
+
+  }; // end of class IndexedEstimatorCache
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'IndexedEstimatorCache'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'IndexedEstimatorCache' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename T>
+  std::ostream&
+  operator<< ( std::ostream & out, const IndexedEstimatorCache<T> & object )
+  {
+    object.selfDisplay( out );
+    return out;
+  }
+
+} // namespace DGtal
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined IndexedEstimatorCache_h
+
+#undef IndexedEstimatorCache_RECURSES
+#endif // else defined(IndexedEstimatorCache_RECURSES)
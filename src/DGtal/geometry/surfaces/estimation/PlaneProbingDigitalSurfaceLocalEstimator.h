@@ -42,8 +42,10 @@
 // Inclusions
 #include <iostream>
 #include <unordered_map>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/geometry/surfaces/DigitalSurfacePredicate.h"
+#include "DGtal/geometry/surfaces/PackedDigitalSurfacePredicate.h"
 #include "DGtal/geometry/surfaces/estimation/MaximalSegmentSliceEstimation.h"
 #include "DGtal/topology/KhalimskyCellHashFunctions.h"
 #include "DGtal/topology/CDigitalSurfaceContainer.h"
@@ -61,6 +63,11 @@ namespace DGtal
    * This class uses a plane-probing algorithm (whose type is given by the template parameter TProbingAlgorithm) to estimate
    * normal vectors on a digital surface per surfel.
    *
+   * The predicate given to the probing algorithms is the predicate type of TInternalProbingAlgorithm,
+   * either DigitalSurfacePredicate or PackedDigitalSurfacePredicate. With the latter, the surfels of
+   * a range may be processed in one batch (see evalBatch): surfels are processed in parallel and runs are
+   * reused across neighboring surfels.
+   *
    * @tparam TSurface the digital surface type.
    * @tparam TInternalProbingAlgorithm the probing algorithm (see \ref PlaneProbingTetrahedronEstimator or PlaneProbingParallelepipedEstimator).
    *
@@ -111,7 +118,7 @@ namespace DGtal
           }
       };
 
-      using Predicate               = DigitalSurfacePredicate<Surface>;
+      using Predicate               = typename InternalProbingAlgorithm::Predicate;
       using ProbingFactory          = std::function<InternalProbingAlgorithm*(const ProbingFrame&, Predicate const&)>;
       using PreEstimation           = MaximalSegmentSliceEstimation<Surface>;
       using PointOnProbingRay       = typename InternalProbingAlgorithm::PointOnProbingRay;
@@ -230,6 +237,34 @@ namespace DGtal
     template < typename SurfelConstIterator, typename OutputIterator >
     OutputIterator eval (SurfelConstIterator itb, SurfelConstIterator ite, OutputIterator out);
 
+    /**
+     * Estimates the quantity on a range of surfels, in parallel when DGtal is built with OpenMP,
+     * with the same results as eval(itb, ite, out). It requires the predicate to be a
+     * PackedDigitalSurfacePredicate.
+     *
+     * Consecutive surfels of the range are grouped in chunks of \a aChunkSize surfels that are
+     * distributed over threads. Within a chunk, the predicate queries of each probing run are
+     * logged. A surfel whose probing frame has the same directions as the frame of the last run
+     * of the chunk with these directions reuses the result of that run if all the logged queries
+     * have the same answers once translated by the difference of base points: the run would be
+     * the translated copy of the logged one. Since the range of a digital surface is usually given by a traversal, neighboring
+     * surfels lying on the same piece of plane are mostly consecutive.
+     *
+     * @param itb an iterator on the start of the range of surfels.
+     * @param ite a past-the-end iterator of the range of surfels.
+     * @param out an output iterator to store the results.
+     * @param aChunkSize the number of consecutive surfels processed by the same thread.
+     * @return the modified output iterator.
+     */
+    template < typename SurfelConstIterator, typename OutputIterator >
+    OutputIterator evalBatch (SurfelConstIterator itb, SurfelConstIterator ite, OutputIterator out,
+                              std::size_t aChunkSize = 256);
+
+    /**
+     * @return the number of probing runs reused by the last call to evalBatch.
+     */
+    std::size_t nbReusedRuns () const;
+
     /**
      * @return the gridstep.
      */
@@ -281,7 +316,6 @@ namespace DGtal
 
     // ------------------------- Private Datas --------------------------------
   private:
-    InternalProbingAlgorithm* myProbingAlgorithm = nullptr; /**< A pointer on the probing algorithm, instantiated in eval. */
     Scalar myH; /**< The gridstep. */
     CountedConstPtrOrConstPtr<Surface> mySurface; /**< A constant pointer on the digital surface. */
     Predicate myPredicate; /**< The InPlane predicate. */
@@ -289,6 +323,18 @@ namespace DGtal
     ProbingFactory myProbingFactory; /**< A factory function to build plane-probing estimators from a frame, used in eval. */
     mutable std::unordered_map<Surfel, RealPoint> myPreEstimations; /**< A hashmap of pre-estimation vectors */
     bool myVerbose; /**< Verbosity flag. */
+    std::size_t myNbReusedRuns = 0; /**< The number of probing runs reused by the last evalBatch. */
+
+    /**
+     * A probing run logged in evalBatch: the frame, the logged predicate queries and the result.
+     */
+    struct ProbingRun
+    {
+        ProbingFrame frame; /**< The probing frame. */
+        int zeros; /**< The null components of the pre-estimation, as a bit mask. */
+        typename Predicate::QueryLog log; /**< The queries of the run and their answers. */
+        Quantity normal; /**< The estimated normal. */
+    };
 
     // ------------------------- Hidden services ------------------------------
   protected:
@@ -313,6 +359,16 @@ namespace DGtal
      */
     ProbingFrame probingFrameWithPreEstimation (ProbingFrame const& aInitialFrame, RealPoint const& aPreEstimation) const;
 
+    /**
+     * Runs a probing algorithm built by myProbingFactory from a frame, as eval does.
+     *
+     * @param aFrame a probing frame.
+     * @param aPreEstimation the pre-estimation vector used to build the frame.
+     * @param aPredicate the predicate given to the probing factory.
+     * @return the estimated normal.
+     */
+    Quantity probe (ProbingFrame const& aFrame, RealPoint const& aPreEstimation, Predicate const& aPredicate) const;
+
     /**
      * @param x a scalar.
      * @return an integer that is 1 if x is non-negative, 0 otherwise.
@@ -367,16 +423,17 @@ namespace DGtal
     /**
      * Computes the estimated normal when we detected that one direction of the space was flat.
      *
+     * @param aProbingAlgorithm a probing algorithm, built by myProbingFactory (see probe).
      * @param aIndex an integer between 0 and 2.
      * @return the estimated normal.
      */
-    Point getNormalOneFlatDirection (int aIndex) const
+    static Point getNormalOneFlatDirection (InternalProbingAlgorithm const& aProbingAlgorithm, int aIndex)
     {
         int im1 = (aIndex - 1 + 3) % 3,
             im2 = (aIndex - 2 + 3) % 3;
 
-        return myProbingAlgorithm->m(im1).crossProduct(myProbingAlgorithm->m(aIndex)) +
-            myProbingAlgorithm->m(aIndex).crossProduct(myProbingAlgorithm->m(im2));
+        return aProbingAlgorithm.m(im1).crossProduct(aProbingAlgorithm.m(aIndex)) +
+            aProbingAlgorithm.m(aIndex).crossProduct(aProbingAlgorithm.m(im2));
     }
   }; // end of class PlaneProbingDigitalSurfaceLocalEstimator
 
@@ -42,9 +42,10 @@
 // Inclusions
 #include <iostream>
 #include <vector>
+#include <utility>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Clone.h"
-#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -63,6 +64,18 @@ namespace DGtal
 
      Bins are characterized by one Point and are organized as a
      rectangular domain with lowest bin at coordinates (0,...,0).
+
+     Points are stored in compressed rows: all the points are sorted
+     by bins in one array, and an array of offsets gives for each bin
+     the range of its points. Each point is also identified by its
+     index, i.e. its rank of insertion, so that callers may associate
+     data to points in plain vectors. Newly pushed points are first
+     chained per bin, and the rows are rebuilt with a counting sort
+     (in parallel when OpenMP is available) once there are more
+     chained points than points in rows, so that pushing costs an
+     amortized constant time per point. Proximity queries (points
+     within a ball, k nearest neighbors) are answered for one point
+     or for a whole batch of points in parallel.
      
      @tparam TSpace the digital space, a model of CSpace.
 
@@ -79,8 +92,9 @@ namespace DGtal
     typedef typename Point::Coordinate Coordinate;
     typedef HyperRectDomain<Space> Domain;
     typedef std::vector<Point> Storage;
-    typedef ImageContainerBySTLVector<Domain,Storage*> StorageArray;
-    typedef typename StorageArray::ConstRange BinConstRange;
+    typedef std::size_t Size;
+    typedef std::size_t Index;
+    typedef std::vector<Index> Indices;
 
     // ----------------------- Standard services ------------------------------
   public:
@@ -129,19 +143,38 @@ namespace DGtal
     */
     Point uppermost( Point b ) const;
 
+    /// @return the number of points stored in the bins.
+    Size nbPoints() const;
+
+    /// @return the number of bins, i.e. the size of binDomain().
+    Size nbBins() const;
+
+    /**
+       @param i the index of a stored point.
+       @return the point of index \a i.
+    */
+    const Point& point( Index i ) const;
+
     /**
        Pushes the point \a p into its bin (beware, if you push the same
        point several times, there are as many copies of this point
-       into the bin).
+       into the bin). Its index is the former number of points.
 
        @param p any point within domain().
+
+       @note The point is chained to its bin in amortized constant
+       time, the compressed rows being rebuilt when chained points
+       outnumber the points in rows.
     */
     void push( const Point& p );
 
     /**
        Pushes the range of points [it, itE) into the corresponding bins
        (beware, if you push the same point several times, there are as
-       many copies of this point into its bin).
+       many copies of this point into its bin). Points are indexed
+       consecutively in the order of the range. The bins are rebuilt
+       by a (parallel) counting sort when chained points outnumber the
+       points in rows.
 
        @tparam PointConstIterator the type of const iterator on point.
        @param it an iterator pointing at the beginning of the range.
@@ -175,6 +208,67 @@ namespace DGtal
     void getPoints( std::vector<Point> & pts, 
                     Point bin_lo, Point bin_up ) const;
 
+    /**
+       Pushes back in \a indices the indices of all the points in the
+       bin domain [\a bin_lo, \a bin_up].
+
+       @param[out] indices the vector where indices are pushed back for output.
+       @param bin_lo the lowest bin of the bin domain.
+       @param bin_up the uppermost bin of the bin domain.
+    */
+    void getIndices( Indices & indices,
+                     Point bin_lo, Point bin_up ) const;
+
+    /**
+       Pushes back in \a indices the indices of the points at
+       Euclidean distance at most \a radius from \a p, sorted by
+       increasing index.
+
+       @param[out] indices the vector where indices are pushed back for output.
+       @param p any point.
+       @param radius the radius of the ball centered at \a p.
+    */
+    void getIndicesInBall( Indices & indices,
+                           const Point& p, double radius ) const;
+
+    /**
+       Batch version of getIndicesInBall, where queries are processed
+       in parallel.
+
+       @param queries a range of points.
+       @param radius the radius of the balls centered at each query point.
+       @return for each query point, the sorted indices of the points
+       at Euclidean distance at most \a radius.
+    */
+    std::vector<Indices> getIndicesInBalls( const std::vector<Point>& queries,
+                                            double radius ) const;
+
+    /**
+       Pushes back in \a indices the indices of the \a k points
+       closest to \a p (or all the points if there are fewer),
+       sorted by increasing Euclidean distance then increasing index.
+       Bins are visited by growing shells around the bin of \a p
+       until no unvisited point may be closer than the k-th one.
+
+       @param[out] indices the vector where indices are pushed back for output.
+       @param p any point.
+       @param k the number of neighbors.
+    */
+    void getKNearestIndices( Indices & indices,
+                             const Point& p, Size k ) const;
+
+    /**
+       Batch version of getKNearestIndices, where queries are
+       processed in parallel.
+
+       @param queries a range of points.
+       @param k the number of neighbors.
+       @return for each query point, the indices of its \a k nearest
+       points, sorted by increasing distance.
+    */
+    std::vector<Indices> getKNearestIndices( const std::vector<Point>& queries,
+                                             Size k ) const;
+
     // ----------------------- Interface --------------------------------------
   public:
 
@@ -197,9 +291,24 @@ namespace DGtal
     Domain myDomain;
     /// the edge size of each bin.
     Coordinate mySize;
-    /// the image that associates to each bin its dyn. allocated
-    /// vector of points. If 0, no point is stored in this bin.
-    StorageArray myArray;
+    /// the rectangular domain of bins.
+    Domain myBinDomain;
+    /// the stored points, by increasing index.
+    Storage myPoints;
+    /// for each bin b, its points are at ranks [myOffsets[b],myOffsets[b+1]) in
+    /// mySortedPoints and myIndices (size is nbBins()+1). Points of index
+    /// myOffsets.back() and above are not in rows but chained.
+    std::vector<Size> myOffsets;
+    /// the stored points sorted by bins.
+    Storage mySortedPoints;
+    /// the indices of the points of mySortedPoints.
+    Indices myIndices;
+    /// for each bin, one more than the index of its last chained point
+    /// (0 if none), or empty when no point is chained.
+    Indices myChainHeads;
+    /// for each chained point, one more than the index of the previous
+    /// chained point of its bin (0 if none).
+    Indices myChainNexts;
     // ------------------------- Private Datas --------------------------------
   private:
     /// a precomputed point to improve performance of uppermost() method.
@@ -208,6 +317,45 @@ namespace DGtal
     // ------------------------- Hidden services ------------------------------
   protected:
 
+    /**
+       @param b any valid bin of binDomain().
+       @return the rank of bin \a b in myOffsets.
+    */
+    Size binRank( const Point& b ) const;
+
+    /// Sorts myPoints by bins into the compressed rows mySortedPoints,
+    /// myIndices and myOffsets, and empties the chains.
+    void sortPoints();
+
+    /// Chains the last point of myPoints to its bin.
+    void chainLastPoint();
+
+    /**
+       Calls \a visit( point, index ) for each point of a bin, first
+       the points in rows then the chained ones.
+
+       @tparam PointIndexVisitor the type of a functor on (Point,Index).
+       @param r the rank of a valid bin.
+       @param visit the functor called on each point of the bin.
+    */
+    template <typename PointIndexVisitor>
+    void visitBin( Size r, PointIndexVisitor & visit ) const;
+
+    /**
+       Visits the points of the bins in [\a bin_lo, \a bin_up] and
+       pushes in \a candidates the pairs (squared distance to \a p,
+       index) of the ones at squared distance at most \a maxSqDist.
+    */
+    void getCandidates( std::vector< std::pair<double,Index> > & candidates,
+                        const Point& p, Point bin_lo, Point bin_up,
+                        double maxSqDist ) const;
+
+    /// @return the squared Euclidean distance between \a p and \a q.
+    static double squaredDistance( const Point& p, const Point& q );
+
+    /// @return the number of chunks to split parallel loops into.
+    static Size nbChunks();
+
     // ------------------------- Internals ------------------------------------
   private:
 
@@ -42,6 +42,9 @@
 // Inclusions
 #include <cmath>
 #include <iostream>
+#include <vector>
+#include <map>
+#include <mutex>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/BasicMathFunctions.h"
 #include "DGtal/kernel/BasicPointPredicates.h"
@@ -64,8 +67,19 @@ namespace DGtal
    * of a set of points. It can compute the covariance measure of an
    * arbitrary function with given support.
    *
-   * You may obtain the whole sequence (Point,VCM) by accessing the
-   * map \ref vcmMap.
+   * The sites of the VCM are the distinct input points, sorted
+   * lexicographically, and the Voronoi covariance matrices are stored
+   * in a vector indexed like the sites. Sites are also the points of
+   * the proximity structure, with the same indices, so that kernel
+   * integrations never look sites up by their coordinates. You may
+   * obtain the whole sequence (Point,VCM) with \ref vcmMap, or the
+   * dense vectors with \ref sites and \ref vcmMatrices.
+   *
+   * The VCM is accumulated only over the bins of the proximity
+   * structure that are close enough to a site to intersect the
+   * R-offset (the narrow band), in parallel when OpenMP is
+   * available: each thread sums into its own matrices per site, and
+   * these are added afterwards.
    *
    * @note Documentation in \ref moduleVCM_sec2.
    *
@@ -121,6 +135,8 @@ namespace DGtal
     typedef typename MatrixNN::RowVector VectorN;             ///< the type for N-vector of real numbers
     typedef std::vector<Point> PointContainer;                ///< the list of points
     typedef std::map<Point,MatrixNN> Point2MatrixNN;          ///< Associates a matrix to points.
+    typedef std::vector<MatrixNN> MatrixNNContainer;          ///< the list of matrices
+    typedef typename ProximityStructure::Index Index;         ///< the type for indexing sites
 
     // ----------------------- Standard services ------------------------------
   public:
@@ -182,8 +198,28 @@ namespace DGtal
     /// @return the Voronoi Covariance Matrix of each Voronoi cell as
     /// a map Point -> Matrix
     /// @note empty if \ref init has not been called.
+    /// @note the map is built from \ref sites and \ref vcmMatrices,
+    /// which give the same data as dense vectors, at the first call
+    /// after \ref init, and kept until the next \ref init.
     const Point2MatrixNN& vcmMap() const;
 
+    /// @return the sites of the VCM, i.e. the distinct input points
+    /// sorted lexicographically.
+    /// @note empty if \ref init has not been called.
+    const PointContainer& sites() const;
+
+    /// @return the Voronoi Covariance Matrix of each Voronoi cell,
+    /// indexed like \ref sites.
+    /// @note empty if \ref init has not been called.
+    const MatrixNNContainer& vcmMatrices() const;
+
+    /**
+       @param q any point.
+       @return the index of site \a q in \ref sites, or the number of
+       sites if \a q is not a site.
+    */
+    Index siteIndex( const Point& q ) const;
+
     /**
     Computes the Voronoi Covariance Measure of the function \a chi_r.
     
@@ -200,6 +236,28 @@ namespace DGtal
     template <typename Point2ScalarFunction>
     MatrixNN measure( Point2ScalarFunction chi_r, Point p ) const;
 
+    /**
+    Computes the Voronoi Covariance Measure of the function \a chi_r
+    moved at each point of \a points. Points are processed in
+    parallel (when OpenMP is available) and the result is indexed
+    like \a points.
+
+    @tparam Point2ScalarFunction the type of a functor Point->Scalar,
+    whose evaluation must be thread-safe.
+
+    @param chi_r the kernel function whose support is included in
+    the cube centered on the origin with edge size 2r (see \ref
+    VoronoiCovarianceMeasure).
+
+    @param points the points where the kernel function is moved. They
+    must lie within domain.
+
+    @return the vector of the measures at each point.
+    */
+    template <typename Point2ScalarFunction>
+    MatrixNNContainer measures( Point2ScalarFunction chi_r,
+                                const PointContainer& points ) const;
+
     // ----------------------- Interface --------------------------------------
   public:
 
@@ -235,8 +293,15 @@ namespace DGtal
     CharacteristicSet* myCharSet;
     /// Stores the voronoi map.
     Voronoi* myVoronoi;
-    /// The map point -> VCM
-    Point2MatrixNN myVCM;
+    /// The sites, i.e. the distinct input points sorted lexicographically.
+    PointContainer mySites;
+    /// The VCM of each site, indexed like mySites.
+    MatrixNNContainer myVCM;
+    /// The VCM of each site as a map Point -> Matrix, derived from
+    /// mySites and myVCM by vcmMap (empty until its first call).
+    mutable Point2MatrixNN myVCMMap;
+    /// Protects the construction of myVCMMap.
+    mutable std::mutex myVCMMapMutex;
     /// The structure used for proximity queries.
     ProximityStructure* myProximityStructure;
 
@@ -269,6 +334,14 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+       @return the bins of the proximity structure that may contain
+       points at distance at most R of a site, in the order of the
+       bin domain.
+       @pre init has built the sites and the proximity structure.
+    */
+    std::vector<Point> narrowBandBins() const;
+
   }; // end of class VoronoiCovarianceMeasure
 
 
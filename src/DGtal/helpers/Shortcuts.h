@@ -60,6 +60,8 @@
 #include "DGtal/shapes/GaussDigitizer.h"
 #include "DGtal/shapes/ShapeGeometricFunctors.h"
 #include "DGtal/shapes/MeshHelpers.h"
+#include "DGtal/shapes/SurfaceMesh.h"
+#include "DGtal/shapes/ImageSurfaceExtractor.h"
 #include "DGtal/topology/CCellularGridSpaceND.h"
 #include "DGtal/topology/LightImplicitDigitalSurface.h"
 #include "DGtal/topology/SetOfSurfels.h"
@@ -184,6 +186,7 @@ namespace DGtal
       typedef ::DGtal::Mesh<RealPoint>                            Mesh;
       typedef ::DGtal::TriangulatedSurface<RealPoint>             TriangulatedSurface;
       typedef ::DGtal::PolygonalSurface<RealPoint>                PolygonalSurface;
+      typedef ::DGtal::SurfaceMesh<RealPoint,RealVector>          SurfaceMesh;
       typedef std::map<Surfel, IdxSurfel>                         Surfel2Index;
       typedef std::map<Cell,   IdxVertex>                         Cell2Index;
 
@@ -2359,6 +2362,190 @@ namespace DGtal
           return makePrimalPolygonalSurface( c2i, dsurf );
         }
 
+      /// Builds directly from a binary image the dual triangulated
+      /// surface of the boundary of its shape, without building a
+      /// digital surface (see ImageSurfaceExtractor). The surface is
+      /// the same as makeTriangulatedSurface( makeDigitalSurface(
+      /// bimage, K, params ) ), vertices being numbered differently:
+      /// non triangular faces are triangulated by putting a centroid
+      /// vertex.
+      ///
+      /// @param[in] bimage a binary image representing the
+      /// characteristic function of a digital shape.
+      /// @param[in] params the parameters:
+      ///   - surfelAdjacency[0]: specifies the surfel adjacency (1:ext, 0:int)
+      /// @return a smart pointer on the built triangulated surface.
+      static CountedPtr< TriangulatedSurface >
+        makeTriangulatedSurface( CountedPtr<BinaryImage> bimage,
+                                 const Parameters&       params = parametersDigitalSurface() )
+      {
+        BOOST_STATIC_ASSERT (( KSpace::dimension == 3 ));
+        ImageSurfaceExtractor< BinaryImage > extractor
+          ( *bimage, false, params[ "surfelAdjacency" ].as<int>() == 1 );
+        typename ImageSurfaceExtractor< BinaryImage >::RealPoints positions;
+        typename ImageSurfaceExtractor< BinaryImage >::Faces      faces;
+        extractor.extractDual( positions, faces );
+        auto pTriSurf = CountedPtr<TriangulatedSurface>
+          ( new TriangulatedSurface ); // acquired
+        for ( const auto& p : positions ) pTriSurf->addVertex( p );
+        for ( const auto& f : faces )
+          {
+            if ( f.size() == 3 )
+              pTriSurf->addTriangle( f[ 0 ], f[ 1 ], f[ 2 ] );
+            else
+              {
+                typename ImageSurfaceExtractor< BinaryImage >::RealPoint barycenter;
+                for ( auto v : f ) barycenter += positions[ v ];
+                barycenter /= f.size();
+                const auto idx = pTriSurf->addVertex( barycenter );
+                for ( std::size_t i = 0; i < f.size(); ++i )
+                  pTriSurf->addTriangle( f[ i ], f[ ( i + 1 ) % f.size() ], idx );
+              }
+          }
+        pTriSurf->build();
+        return pTriSurf;
+      }
+
+      /// Builds directly from a binary image the dual polygonal
+      /// surface of the boundary of its shape, without building a
+      /// digital surface (see ImageSurfaceExtractor). Vertex i is the
+      /// i-th surfel of the extractor.
+      ///
+      /// @param[in] bimage a binary image representing the
+      /// characteristic function of a digital shape.
+      /// @param[in] params the parameters:
+      ///   - surfelAdjacency[0]: specifies the surfel adjacency (1:ext, 0:int)
+      /// @return a smart pointer on the built polygonal surface.
+      static CountedPtr< PolygonalSurface >
+        makeDualPolygonalSurface( CountedPtr<BinaryImage> bimage,
+                                  const Parameters&       params = parametersDigitalSurface() )
+      {
+        BOOST_STATIC_ASSERT (( KSpace::dimension == 3 ));
+        ImageSurfaceExtractor< BinaryImage > extractor
+          ( *bimage, false, params[ "surfelAdjacency" ].as<int>() == 1 );
+        typename ImageSurfaceExtractor< BinaryImage >::RealPoints positions;
+        typename ImageSurfaceExtractor< BinaryImage >::Faces      faces;
+        extractor.extractDual( positions, faces );
+        auto pPolySurf = CountedPtr<PolygonalSurface>
+          ( new PolygonalSurface ); // acquired
+        for ( const auto& p : positions ) pPolySurf->addVertex( p );
+        for ( const auto& f : faces )
+          pPolySurf->addPolygonalFace( typename PolygonalSurface::PolygonalFace
+                                       ( f.cbegin(), f.cend() ) );
+        pPolySurf->build();
+        return pPolySurf;
+      }
+
+      /// Builds directly from a binary image the primal polygonal
+      /// surface of the boundary of its shape, without building a
+      /// digital surface (see ImageSurfaceExtractor). Face i is the
+      /// i-th surfel of the extractor.
+      ///
+      /// @param[in] bimage a binary image representing the
+      /// characteristic function of a digital shape.
+      /// @return a smart pointer on the built polygonal surface or 0 if it fails because the boundary is not a combinatorial 2-manifold.
+      static CountedPtr< PolygonalSurface >
+        makePrimalPolygonalSurface( CountedPtr<BinaryImage> bimage )
+      {
+        BOOST_STATIC_ASSERT (( KSpace::dimension == 3 ));
+        ImageSurfaceExtractor< BinaryImage > extractor( *bimage, false );
+        typename ImageSurfaceExtractor< BinaryImage >::RealPoints positions;
+        typename ImageSurfaceExtractor< BinaryImage >::Faces      faces;
+        extractor.extractPrimal( positions, faces );
+        auto pPolySurf = CountedPtr<PolygonalSurface>
+          ( new PolygonalSurface ); // acquired
+        for ( const auto& p : positions ) pPolySurf->addVertex( p );
+        for ( const auto& f : faces )
+          pPolySurf->addPolygonalFace( typename PolygonalSurface::PolygonalFace
+                                       ( f.cbegin(), f.cend() ) );
+        bool ok = pPolySurf->build();
+        return ok ? pPolySurf : CountedPtr< PolygonalSurface >( nullptr );
+      }
+
+      /// Builds directly from a binary image the dual surface mesh of
+      /// the boundary of its shape (see ImageSurfaceExtractor). Unlike
+      /// the polygonal surfaces, a surface mesh accepts non-manifold
+      /// boundaries.
+      ///
+      /// @param[in] bimage a binary image representing the
+      /// characteristic function of a digital shape.
+      /// @param[in] params the parameters:
+      ///   - surfelAdjacency[0]: specifies the surfel adjacency (1:ext, 0:int)
+      /// @return a smart pointer on the built surface mesh.
+      static CountedPtr< SurfaceMesh >
+        makeDualSurfaceMesh( CountedPtr<BinaryImage> bimage,
+                             const Parameters&       params = parametersDigitalSurface() )
+      {
+        BOOST_STATIC_ASSERT (( KSpace::dimension == 3 ));
+        ImageSurfaceExtractor< BinaryImage > extractor
+          ( *bimage, false, params[ "surfelAdjacency" ].as<int>() == 1 );
+        typename ImageSurfaceExtractor< BinaryImage >::RealPoints positions;
+        typename ImageSurfaceExtractor< BinaryImage >::Faces      faces;
+        extractor.extractDual( positions, faces );
+        return CountedPtr<SurfaceMesh>
+          ( new SurfaceMesh( positions.cbegin(), positions.cend(),
+                             faces.cbegin(), faces.cend() ) );
+      }
+
+      /// Builds directly from a 3D gray-scale image the dual surface
+      /// mesh that approximates its iso-surface of value
+      /// "thresholdMin+0.5", as makePolygonalSurface( gray_scale_image,
+      /// params ) but without building a digital surface (see
+      /// ImageSurfaceExtractor).
+      ///
+      /// @param[in] gray_scale_image any gray-scale image.
+      /// @param[in] params the parameters:
+      ///   - surfelAdjacency[0]: specifies the surfel adjacency (1:ext, 0:int)
+      ///   - thresholdMin   [0]: specifies the threshold min (excluded) to define binary shape (thresholdMax is not used)
+      ///   - gridsizex    [1.0]: specifies the space between points along x.
+      ///   - gridsizey    [1.0]: specifies the space between points along y.
+      ///   - gridsizez    [1.0]: specifies the space between points along z.
+      /// @return a smart pointer on the built surface mesh.
+      static CountedPtr< SurfaceMesh >
+        makeDualSurfaceMesh( CountedPtr<GrayScaleImage> gray_scale_image,
+                             const Parameters&          params =
+                             parametersKSpace()
+                             | parametersBinaryImage()
+                             | parametersDigitalSurface() )
+      {
+        BOOST_STATIC_ASSERT (( KSpace::dimension == 3 ));
+        ImageSurfaceExtractor< GrayScaleImage > extractor
+          ( *gray_scale_image,
+            (GrayScale) params[ "thresholdMin" ].as<int>(),
+            params[ "surfelAdjacency" ].as<int>() == 1 );
+        typename ImageSurfaceExtractor< GrayScaleImage >::RealPoints positions;
+        typename ImageSurfaceExtractor< GrayScaleImage >::Faces      faces;
+        extractor.extractDual( positions, faces, true );
+        RealVector gh = { params[ "gridsizex" ].as<double>(),
+                          params[ "gridsizey" ].as<double>(),
+                          params[ "gridsizez" ].as<double>() };
+        for ( auto& p : positions )
+          for ( Dimension i = 0; i < 3; ++i ) p[ i ] *= gh[ i ];
+        return CountedPtr<SurfaceMesh>
+          ( new SurfaceMesh( positions.cbegin(), positions.cend(),
+                             faces.cbegin(), faces.cend() ) );
+      }
+
+      /// Builds directly from a binary image the primal surface mesh
+      /// of the boundary of its shape (see ImageSurfaceExtractor).
+      /// Face i is the i-th surfel of the extractor.
+      ///
+      /// @param[in] bimage a binary image representing the
+      /// characteristic function of a digital shape.
+      /// @return a smart pointer on the built surface mesh.
+      static CountedPtr< SurfaceMesh >
+        makePrimalSurfaceMesh( CountedPtr<BinaryImage> bimage )
+      {
+        BOOST_STATIC_ASSERT (( KSpace::dimension == 3 ));
+        ImageSurfaceExtractor< BinaryImage > extractor( *bimage, false );
+        typename ImageSurfaceExtractor< BinaryImage >::RealPoints positions;
+        typename ImageSurfaceExtractor< BinaryImage >::Faces      faces;
+        extractor.extractPrimal( positions, faces );
+        return CountedPtr<SurfaceMesh>
+          ( new SurfaceMesh( positions.cbegin(), positions.cend(),
+                             faces.cbegin(), faces.cend() ) );
+      }
+
       /// Outputs a polygonal surface as an OBJ file (with its topology).
       ///
       /// @tparam TPoint any model of point
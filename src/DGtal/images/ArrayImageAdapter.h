@@ -46,6 +46,7 @@
 #include <DGtal/base/Common.h>
 #include <DGtal/images/CConstImage.h>
 #include <DGtal/images/ArrayImageIterator.h>
+#include <DGtal/images/ImageRowSpan.h>
 #include <DGtal/base/IteratorCompletion.h>
 #include <DGtal/kernel/domains/Linearizer.h>
 //////////////////////////////////////////////////////////////////////////////
@@ -259,6 +260,26 @@ namespace DGtal
           return getValue(aPoint);
         }
 
+      /** Returns the values from a point to the end of its row along the first axis of the viewable domain.
+       *
+       * These values are contiguous in the adapted array.
+       * As the other accesses of this adapter, the span gives a mutable access to the array.
+       *
+       * @param[in] aPoint  Point in the viewable domain.
+       * @return a span of (viewable upper bound[0] - aPoint[0] + 1) values.
+       */
+      ImageRowSpan<ArrayIterator> rowSpan( Point const& aPoint ) const
+        {
+          ASSERT_MSG(
+              myViewDomain.isInside(aPoint),
+              "The point is outside the viewable domain !"
+          );
+
+          return ImageRowSpan<ArrayIterator>(
+              myArrayIterator + Linearizer::getIndex(aPoint, myFullDomain),
+              static_cast<std::size_t>( myViewDomain.upperBound()[0] - aPoint[0] + 1 ) );
+        }
+
       /**
        * @return a mutable iterator pointing to the lower bound of the viewable domain.
        */
@@ -0,0 +1,327 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file AsyncImageFactory.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module AsyncImageFactory.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(AsyncImageFactory_RECURSES)
+#error Recursive header files inclusion detected in AsyncImageFactory.h
+#else // defined(AsyncImageFactory_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define AsyncImageFactory_RECURSES
+
+#if !defined AsyncImageFactory_h
+/** Prevents repeated inclusion of headers. */
+#define AsyncImageFactory_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <map>
+#include <set>
+#include <deque>
+#include <memory>
+#include <utility>
+#include <functional>
+#include <exception>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConceptUtils.h"
+#include "DGtal/base/Alias.h"
+#include "DGtal/images/CImageFactory.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // Template class AsyncImageFactory
+  /**
+   * Description of template class 'AsyncImageFactory' <p>
+   * \brief Aim: adapts an image factory so that images are loaded
+   * ahead of time and flushed on a background thread.
+   *
+   * prefetch() requests an image from the adapted factory on a worker
+   * thread; a later requestImage() of the same domain takes this image,
+   * waiting for its loading if needed, instead of loading it again.
+   * TiledImage calls prefetch() with the next tiles of its iteration
+   * (or of an access plan, see TiledImage::setPrefetching), so that the
+   * next tiles are read while the current one is processed.
+   *
+   * By default, flushImage() waits for the flush, done on the worker
+   * thread. With the asynchronous flush, it only queues the flush, and
+   * detachImage() of an image being flushed frees it after its flush.
+   * This is meant for the write-back policy (ImageCacheWritePolicyWB),
+   * which flushes the pages it replaces: the write-through policy
+   * (ImageCacheWritePolicyWT) flushes pages while still in use, and
+   * asserts that the flush is synchronous.
+   *
+   * The tasks are processed in order by a single worker thread, so that
+   * a domain loaded after the flush of an image is read with the flushed
+   * values. Prefetched images are only given for domains which are not
+   * held by the cache (requested and not detached), and prefetches
+   * started before the flush of the same domain are discarded.
+   *
+   * The adapted factory is only used by the worker thread, so that it
+   * does not need to be thread-safe.
+   *
+   * @tparam TImageFactory an image factory type (model of CImageFactory).
+   *
+   * @see TiledImage
+   */
+  template <typename TImageFactory>
+  class AsyncImageFactory
+  {
+
+    // ----------------------- Types ------------------------------
+
+  public:
+    typedef AsyncImageFactory<TImageFactory> Self;
+
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( concepts::CImageFactory<TImageFactory> ));
+
+    ///Types copied from the factory
+    typedef TImageFactory ImageFactory;
+    typedef typename ImageFactory::Domain Domain;
+    typedef typename ImageFactory::OutputImage OutputImage;
+    typedef typename Domain::Point Point;
+
+    /// Tells TiledImage that the factory accepts prefetch requests.
+    typedef TagTrue Prefetching;
+
+    // ----------------------- Standard services ------------------------------
+
+  public:
+
+    /**
+     * Constructor. Starts the worker thread.
+     * @param anImageFactory alias on the adapted image factory.
+     * @param anAsynchronousFlush if true, flushImage() does not wait
+     * for the flush (only for the write-back policy).
+     * @param aMaxPrefetched the maximal number of prefetched images waiting to be requested.
+     */
+    AsyncImageFactory( Alias<ImageFactory> anImageFactory, bool anAsynchronousFlush = false,
+                       unsigned int aMaxPrefetched = 16 );
+
+    /**
+     * Destructor. Waits for the queued tasks and frees the prefetched
+     * images that have not been requested.
+     */
+    ~AsyncImageFactory();
+
+  private:
+
+    AsyncImageFactory( const AsyncImageFactory & other );
+
+    AsyncImageFactory & operator=( const AsyncImageFactory & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Returns a reference to the underlying image domain.
+     *
+     * @return a reference to the domain.
+     */
+    const Domain & domain() const
+    {
+      return myImageFactory->domain();
+    }
+
+    /**
+     * Starts loading the image of domain aDomain on the worker thread,
+     * unless it is already loaded, being loaded or held by the cache, or
+     * if too many images are already prefetched.
+     *
+     * @param aDomain the domain.
+     */
+    void prefetch( const Domain & aDomain );
+
+    /**
+     * Returns a pointer of an OutputImage created with the Domain
+     * aDomain: the prefetched one if any, otherwise an image loaded by
+     * the worker thread (after the queued flushes).
+     *
+     * @param aDomain the domain.
+     * @return an ImagePtr.
+     */
+    OutputImage * requestImage( const Domain & aDomain );
+
+    /**
+     * Flush (i.e. write/synchronize) an OutputImage, asynchronously
+     * or not.
+     *
+     * @param outputImage the OutputImage.
+     */
+    void flushImage( OutputImage * outputImage );
+
+    /**
+     * Free (i.e. delete) an OutputImage, after its flush if it is
+     * being flushed.
+     *
+     * @param outputImage the OutputImage.
+     */
+    void detachImage( OutputImage * outputImage );
+
+    /**
+     * Waits for the queued tasks (loads and flushes).
+     * @throw the first exception raised by an asynchronous flush.
+     */
+    void wait();
+
+    /// @return the number of images loaded by prefetch.
+    std::size_t nbPrefetched() const;
+
+    /// @return the number of requested images that were prefetched.
+    std::size_t nbPrefetchHits() const;
+
+    /// @return the number of asynchronous flushes.
+    std::size_t nbAsynchronousFlushes() const;
+
+    /// @return 'true' if flushImage() does not wait for the flush.
+    bool isAsynchronousFlush() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const
+    {
+      return myImageFactory->isValid();
+    }
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// A domain, by its bounds.
+    typedef std::pair<Point, Point> Key;
+
+    /// An image loaded by the worker thread.
+    struct Load
+    {
+      OutputImage * image;        ///< The loaded image.
+      bool done;                  ///< True once loaded (or failed).
+      bool stale;                 ///< True if the domain was flushed after the load was queued.
+      std::exception_ptr error;   ///< The exception raised by the loading.
+    };
+
+    /// Alias on the adapted factory
+    ImageFactory * myImageFactory;
+
+    /// True if images are flushed on the worker thread.
+    bool myAsynchronousFlush;
+
+    /// The maximal number of prefetched images.
+    unsigned int myMaxPrefetched;
+
+    /// The prefetched images, being loaded or waiting to be requested.
+    std::map< Key, std::shared_ptr<Load> > myPrefetched;
+
+    /// The number of images of each domain held by the cache.
+    std::map< Key, unsigned int > myHeld;
+
+    /// The images being flushed.
+    std::set<OutputImage *> myFlushing;
+
+    /// The images to free after their flush.
+    std::set<OutputImage *> myDetachAfterFlush;
+
+    /// The tasks of the worker thread.
+    std::deque< std::function<void()> > myTasks;
+
+    /// The number of tasks queued or running.
+    std::size_t myNbPendingTasks;
+
+    /// True when the worker thread must stop.
+    bool myStop;
+
+    /// The first exception raised by an asynchronous flush.
+    std::exception_ptr myFlushError;
+
+    /// Counters.
+    std::size_t myNbPrefetched, myNbPrefetchHits, myNbAsynchronousFlushes;
+
+    /// Protects all the datas above.
+    mutable std::mutex myMutex;
+
+    /// Signals new tasks, ended tasks and loaded images.
+    std::condition_variable myCondition;
+
+    /// The worker thread.
+    std::thread myWorker;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @return the key of a domain.
+    static Key keyOf( const Domain & aDomain );
+
+    /// Queues a task, myMutex being locked.
+    void push( std::function<void()> aTask );
+
+    /// Queues the loading of an image, myMutex being locked.
+    std::shared_ptr<Load> pushLoad( const Domain & aDomain );
+
+    /// Waits for a load, myMutex being locked by aLock, and returns its image.
+    OutputImage * take( std::unique_lock<std::mutex> & aLock, const std::shared_ptr<Load> & aLoad );
+
+    /// The loop of the worker thread.
+    void run();
+
+  }; // end of class AsyncImageFactory
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'AsyncImageFactory'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'AsyncImageFactory' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImageFactory>
+  std::ostream&
+  operator<< ( std::ostream & out, const AsyncImageFactory<TImageFactory> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/AsyncImageFactory.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined AsyncImageFactory_h
+
+#undef AsyncImageFactory_RECURSES
+#endif // else defined(AsyncImageFactory_RECURSES)
@@ -46,11 +46,13 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <type_traits>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/base/ConceptUtils.h"
 #include "DGtal/images/CImage.h"
 #include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/images/ImageBlockAccess.h"
 
 #include "DGtal/images/DefaultConstImageRange.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -229,6 +231,22 @@ public:
     }
 
     
+    /**
+     * Reads the values of a row of points along the first axis, as
+     * operator() would. Without domain transformation (TFunctorD is
+     * functors::Identity), the row of the adapted image is read by
+     * chunks with DGtal::getRow and the value functor is applied in a
+     * loop on each chunk, which the compiler may vectorize; otherwise
+     * the values are read point by point.
+     *
+     * @param aPoint the first point of the row.
+     * @param length the number of values.
+     * @param[out] values a buffer of length values.
+     *
+     * @see ImageBlockAccess.h
+     */
+    void getRow( const Point & aPoint, std::size_t length, Value* values ) const;
+
     /////////////////// API //////////////////
 
     /**
@@ -279,6 +297,10 @@ public:
 
     // ------------------------- Protected Datas ------------------------------
 private:
+    /// getRow with and without domain transformation.
+    void getRow( const Point & aPoint, std::size_t length, Value* values, std::true_type ) const;
+    void getRow( const Point & aPoint, std::size_t length, Value* values, std::false_type ) const;
+
     /**
      * Default constructor.
      */
@@ -41,11 +41,13 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <type_traits>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/base/ConceptUtils.h"
 #include "DGtal/images/CImage.h"
 #include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/images/ImageBlockAccess.h"
 
 #include "DGtal/images/DefaultConstImageRange.h"
 #include "DGtal/images/DefaultImageRange.h"
@@ -267,6 +269,33 @@ public:
 
 
 
+    /**
+     * Reads the values of a row of points along the first axis, as
+     * operator() would. Without domain transformation (TFunctorD is
+     * functors::Identity), the row of the adapted image is read by
+     * chunks with DGtal::getRow and the value functor is applied in a
+     * loop on each chunk, which the compiler may vectorize; otherwise
+     * the values are read point by point.
+     *
+     * @param aPoint the first point of the row.
+     * @param length the number of values.
+     * @param[out] values a buffer of length values.
+     *
+     * @see ImageBlockAccess.h
+     */
+    void getRow( const Point & aPoint, std::size_t length, Value* values ) const;
+
+    /**
+     * Sets the values of a row of points along the first axis, as
+     * setValue would, by chunks of values transformed by the inverse
+     * value functor when TFunctorD is functors::Identity.
+     *
+     * @param aPoint the first point of the row.
+     * @param length the number of values.
+     * @param values a buffer of length values.
+     */
+    void setRow( const Point & aPoint, std::size_t length, const Value* values );
+
     /////////////////// API //////////////////
 
     /**
@@ -311,6 +340,14 @@ public:
 
     // ------------------------- Protected Datas ------------------------------
 private:
+    /// getRow with and without domain transformation.
+    void getRow( const Point & aPoint, std::size_t length, Value* values, std::true_type ) const;
+    void getRow( const Point & aPoint, std::size_t length, Value* values, std::false_type ) const;
+
+    /// setRow with and without domain transformation.
+    void setRow( const Point & aPoint, std::size_t length, const Value* values, std::true_type );
+    void setRow( const Point & aPoint, std::size_t length, const Value* values, std::false_type );
+
     /**
      * Default constructor.
      */
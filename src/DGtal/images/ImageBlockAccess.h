@@ -0,0 +1,454 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageBlockAccess.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module ImageBlockAccess.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageBlockAccess_RECURSES)
+#error Recursive header files inclusion detected in ImageBlockAccess.h
+#else // defined(ImageBlockAccess_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageBlockAccess_RECURSES
+
+#if !defined ImageBlockAccess_h
+/** Prevents repeated inclusion of headers. */
+#define ImageBlockAccess_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageRowSpan.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  template <typename TDomain, typename TValue>
+  class ImageContainerBySTLVector;
+
+  template <typename TArrayIterator, typename TDomain>
+  class ArrayImageAdapter;
+
+  template <typename TImageContainer, typename TImageFactory,
+            typename TImageCacheReadPolicy, typename TImageCacheWritePolicy>
+  class TiledImage;
+
+  template <typename TImageContainer, typename TNewDomain, typename TFunctorD,
+            typename TNewValue, typename TFunctorV>
+  class ConstImageAdapter;
+
+  template <typename TImageContainer, typename TNewDomain, typename TFunctorD,
+            typename TNewValue, typename TFunctorV, typename TFunctorVm1>
+  class ImageAdapter;
+
+  namespace functors
+  {
+    struct Identity;
+  }
+
+  namespace detail
+  {
+    /**
+     * Tells if an image has a rowSpan() method giving the values of a
+     * row as a contiguous ImageRowSpan.
+     *
+     * @tparam TImage an image type.
+     */
+    template <typename TImage>
+    struct HasRowSpan : std::false_type {};
+
+    template <typename TDomain, typename TValue>
+    struct HasRowSpan< ImageContainerBySTLVector<TDomain, TValue> > : std::true_type {};
+
+    template <typename TArrayIterator, typename TSpace>
+    struct HasRowSpan< ArrayImageAdapter< TArrayIterator, HyperRectDomain<TSpace> > >
+      : std::true_type {};
+
+    /**
+     * Tells if the rows of an image are accessed faster by the
+     * functions of ImageBlockAccess.h than point by point.
+     *
+     * @tparam TImage an image type.
+     */
+    template <typename TImage>
+    struct IsRowAccessible : HasRowSpan<TImage> {};
+
+    template <typename TImageContainer, typename TImageFactory,
+              typename TImageCacheReadPolicy, typename TImageCacheWritePolicy>
+    struct IsRowAccessible< TiledImage<TImageContainer, TImageFactory,
+                                       TImageCacheReadPolicy, TImageCacheWritePolicy> >
+      : std::true_type {};
+
+    template <typename TImageContainer, typename TSpace,
+              typename TNewValue, typename TFunctorV>
+    struct IsRowAccessible< ConstImageAdapter<TImageContainer, HyperRectDomain<TSpace>,
+                                              functors::Identity, TNewValue, TFunctorV> >
+      : IsRowAccessible<TImageContainer> {};
+
+    template <typename TImageContainer, typename TSpace,
+              typename TNewValue, typename TFunctorV, typename TFunctorVm1>
+    struct IsRowAccessible< ImageAdapter<TImageContainer, HyperRectDomain<TSpace>, functors::Identity,
+                                         TNewValue, TFunctorV, TFunctorVm1> >
+      : IsRowAccessible<TImageContainer> {};
+
+    /**
+     * Tells if distinct rows of an image may be read (and, for images
+     * with a rowSpan() method, written) by several threads at the same
+     * time with the functions of ImageBlockAccess.h: this is the case
+     * of images stored in memory, and of adapters of such images
+     * without domain transformation.
+     *
+     * @tparam TImage an image type.
+     */
+    template <typename TImage>
+    struct IsConcurrentlyRowAccessible : HasRowSpan<TImage> {};
+
+    /// Values of a std::vector<bool> share their words.
+    template <typename TDomain>
+    struct IsConcurrentlyRowAccessible< ImageContainerBySTLVector<TDomain, bool> >
+      : std::false_type {};
+
+    template <typename TImageContainer, typename TSpace,
+              typename TNewValue, typename TFunctorV>
+    struct IsConcurrentlyRowAccessible< ConstImageAdapter<TImageContainer, HyperRectDomain<TSpace>,
+                                                          functors::Identity, TNewValue, TFunctorV> >
+      : IsConcurrentlyRowAccessible<TImageContainer> {};
+
+    template <typename TImageContainer, typename TSpace,
+              typename TNewValue, typename TFunctorV, typename TFunctorVm1>
+    struct IsConcurrentlyRowAccessible< ImageAdapter<TImageContainer, HyperRectDomain<TSpace>,
+                                                     functors::Identity, TNewValue, TFunctorV,
+                                                     TFunctorVm1> >
+      : IsConcurrentlyRowAccessible<TImageContainer> {};
+
+    /**
+     * Implements the block accesses of ImageBlockAccess.h row by row,
+     * with the row accesses of TRowAccess.
+     *
+     * @tparam TImage an image type on an HyperRectDomain.
+     * @tparam TRowAccess a type with static getRow, setRow and fillRow functions.
+     */
+    template <typename TImage, typename TRowAccess>
+    struct ImageBlockRows
+    {
+      typedef typename TImage::Domain Domain;
+      typedef typename TImage::Point Point;
+      typedef typename TImage::Value Value;
+
+      /// See DGtal::getBlock.
+      static void getBlock( const TImage & image, const Domain & aBlock, Value* values );
+
+      /// See DGtal::setBlock.
+      static void setBlock( TImage & image, const Domain & aBlock, const Value* values );
+
+      /// See DGtal::fillBlock.
+      static void fillBlock( TImage & image, const Domain & aBlock, const Value & aValue );
+    };
+
+    /////////////////////////////////////////////////////////////////////////////
+    // template struct ImageBlockAccess
+    /**
+     * Description of template struct 'ImageBlockAccess' <p>
+     * \brief Aim: implements the row and block accesses of
+     * ImageBlockAccess.h for an image type.
+     *
+     * Rows of images with a rowSpan() method (see HasRowSpan) are
+     * copied with std::copy and std::fill_n on their storage, other
+     * rows are accessed point by point with operator() and setValue.
+     * Blocks are accessed row by row. TiledImage is specialized to
+     * access its tiles one after the other, and image adapters without
+     * domain transformation to apply their value functors on the rows
+     * of the adapted image.
+     *
+     * @tparam TImage a model of concepts::CImage (or of
+     * concepts::CConstImage for read accesses) on an HyperRectDomain.
+     */
+    template <typename TImage>
+    struct ImageBlockAccess : ImageBlockRows< TImage, ImageBlockAccess<TImage> >
+    {
+      typedef typename TImage::Domain Domain;
+      typedef typename TImage::Point Point;
+      typedef typename TImage::Value Value;
+      typedef typename HasRowSpan<TImage>::type Direct;
+
+      /// See DGtal::getRow.
+      static void getRow( const TImage & image, const Point & aPoint, std::size_t length,
+                          Value* values );
+
+      /// See DGtal::setRow.
+      static void setRow( TImage & image, const Point & aPoint, std::size_t length,
+                          const Value* values );
+
+      /// See DGtal::fillRow.
+      static void fillRow( TImage & image, const Point & aPoint, std::size_t length,
+                           const Value & aValue );
+
+      /// Rows of images with a rowSpan() method.
+      static void getRow( const TImage & image, const Point & aPoint, std::size_t length,
+                          Value* values, std::true_type );
+      static void setRow( TImage & image, const Point & aPoint, std::size_t length,
+                          const Value* values, std::true_type );
+      static void fillRow( TImage & image, const Point & aPoint, std::size_t length,
+                           const Value & aValue, std::true_type );
+
+      /// Rows of other images, point by point.
+      static void getRow( const TImage & image, const Point & aPoint, std::size_t length,
+                          Value* values, std::false_type );
+      static void setRow( TImage & image, const Point & aPoint, std::size_t length,
+                          const Value* values, std::false_type );
+      static void fillRow( TImage & image, const Point & aPoint, std::size_t length,
+                           const Value & aValue, std::false_type );
+    };
+
+    /**
+     * Specialization for TiledImage, whose accesses are delegated to
+     * TiledImage::getBlock, TiledImage::setBlock and
+     * TiledImage::fillBlock.
+     */
+    template <typename TImageContainer, typename TImageFactory,
+              typename TImageCacheReadPolicy, typename TImageCacheWritePolicy>
+    struct ImageBlockAccess< TiledImage<TImageContainer, TImageFactory,
+                                        TImageCacheReadPolicy, TImageCacheWritePolicy> >
+    {
+      typedef TiledImage<TImageContainer, TImageFactory,
+                         TImageCacheReadPolicy, TImageCacheWritePolicy> Image;
+      typedef typename Image::Domain Domain;
+      typedef typename Image::Point Point;
+      typedef typename Image::Value Value;
+
+      static void getRow( const Image & image, const Point & aPoint, std::size_t length,
+                          Value* values );
+      static void setRow( Image & image, const Point & aPoint, std::size_t length,
+                          const Value* values );
+      static void fillRow( Image & image, const Point & aPoint, std::size_t length,
+                           const Value & aValue );
+      static void getBlock( const Image & image, const Domain & aBlock, Value* values );
+      static void setBlock( Image & image, const Domain & aBlock, const Value* values );
+      static void fillBlock( Image & image, const Domain & aBlock, const Value & aValue );
+
+      /// @return the domain of the row of length values starting at aPoint.
+      static Domain rowDomain( const Point & aPoint, std::size_t length );
+    };
+
+    /**
+     * Specialization for ConstImageAdapter, whose rows are read with
+     * ConstImageAdapter::getRow.
+     */
+    template <typename TImageContainer, typename TNewDomain, typename TFunctorD,
+              typename TNewValue, typename TFunctorV>
+    struct ImageBlockAccess< ConstImageAdapter<TImageContainer, TNewDomain, TFunctorD,
+                                               TNewValue, TFunctorV> >
+      : ImageBlockRows< ConstImageAdapter<TImageContainer, TNewDomain, TFunctorD, TNewValue, TFunctorV>,
+                        ImageBlockAccess< ConstImageAdapter<TImageContainer, TNewDomain, TFunctorD,
+                                                            TNewValue, TFunctorV> > >
+    {
+      typedef ConstImageAdapter<TImageContainer, TNewDomain, TFunctorD, TNewValue, TFunctorV> Image;
+      typedef typename Image::Point Point;
+      typedef typename Image::Value Value;
+
+      static void getRow( const Image & image, const Point & aPoint, std::size_t length,
+                          Value* values );
+    };
+
+    /**
+     * Specialization for ImageAdapter, whose rows are read and written
+     * with ImageAdapter::getRow and ImageAdapter::setRow.
+     */
+    template <typename TImageContainer, typename TNewDomain, typename TFunctorD,
+              typename TNewValue, typename TFunctorV, typename TFunctorVm1>
+    struct ImageBlockAccess< ImageAdapter<TImageContainer, TNewDomain, TFunctorD,
+                                          TNewValue, TFunctorV, TFunctorVm1> >
+      : ImageBlockRows< ImageAdapter<TImageContainer, TNewDomain, TFunctorD,
+                                     TNewValue, TFunctorV, TFunctorVm1>,
+                        ImageBlockAccess< ImageAdapter<TImageContainer, TNewDomain, TFunctorD,
+                                                       TNewValue, TFunctorV, TFunctorVm1> > >
+    {
+      typedef ImageAdapter<TImageContainer, TNewDomain, TFunctorD,
+                           TNewValue, TFunctorV, TFunctorVm1> Image;
+      typedef typename Image::Point Point;
+      typedef typename Image::Value Value;
+
+      static void getRow( const Image & image, const Point & aPoint, std::size_t length,
+                          Value* values );
+      static void setRow( Image & image, const Point & aPoint, std::size_t length,
+                          const Value* values );
+      static void fillRow( Image & image, const Point & aPoint, std::size_t length,
+                           const Value & aValue );
+    };
+
+    /// Number of values of the chunks in which adapted rows are transformed.
+    const std::size_t ADAPTED_ROW_CHUNK_SIZE = 256;
+
+    /**
+     * Reads a row of an image seen through a value functor, as
+     * ConstImageAdapter and ImageAdapter without domain transformation
+     * do: the values of the row inside the domain of the image are read
+     * by chunks (see DGtal::getRow), then transformed in a loop on each
+     * chunk, the others are set to a default value.
+     *
+     * @param image the adapted image.
+     * @param aFunctor the value functor.
+     * @param aDefaultValue the value outside of the domain of image.
+     * @param aPoint the first point of the row.
+     * @param length the number of values.
+     * @param[out] values a buffer of length values.
+     */
+    template <typename TImage, typename TFunctor, typename TValue>
+    void getAdaptedRow( const TImage & image, const TFunctor & aFunctor, const TValue & aDefaultValue,
+                        const typename TImage::Point & aPoint, std::size_t length, TValue* values );
+
+    /**
+     * Sets a row of an image seen through an inverse value functor, as
+     * ImageAdapter without domain transformation does: the values are
+     * transformed by chunks, then written (see DGtal::setRow).
+     *
+     * @param[in,out] image the adapted image, whose domain contains the row.
+     * @param anInverseFunctor the inverse value functor.
+     * @param aPoint the first point of the row.
+     * @param length the number of values.
+     * @param values a buffer of length values.
+     */
+    template <typename TImage, typename TFunctor, typename TValue>
+    void setAdaptedRow( TImage & image, const TFunctor & anInverseFunctor,
+                        const typename TImage::Point & aPoint, std::size_t length, const TValue* values );
+
+    /**
+     * @return the domain of the first points of the rows of a block,
+     * along the first axis.
+     * @param aBlock a non-empty block.
+     */
+    template <typename TDomain>
+    TDomain rowStarts( const TDomain & aBlock );
+
+  } // namespace detail
+
+  /**
+   * Copies the values of a row of an image, from a point along the
+   * first axis, in a buffer.
+   *
+   * For ImageContainerBySTLVector and ArrayImageAdapter, this is a
+   * copy from the storage of the image, without linearizing each
+   * point (see rowSpan()). Other images are read with operator().
+   *
+   * @tparam TImage a model of concepts::CConstImage on an HyperRectDomain.
+   * @param image the image.
+   * @param aPoint the first point of the row.
+   * @param length the number of values, such that the row is in the
+   * domain of the image.
+   * @param[out] values a buffer of length values.
+   */
+  template <typename TImage>
+  void getRow( const TImage & image, const typename TImage::Point & aPoint,
+               std::size_t length, typename TImage::Value* values );
+
+  /**
+   * Sets the values of a row of an image, from a point along the first
+   * axis, from a buffer.
+   *
+   * @tparam TImage a model of concepts::CImage on an HyperRectDomain.
+   * @param[in,out] image the image.
+   * @param aPoint the first point of the row.
+   * @param length the number of values, such that the row is in the
+   * domain of the image.
+   * @param values a buffer of length values.
+   */
+  template <typename TImage>
+  void setRow( TImage & image, const typename TImage::Point & aPoint,
+               std::size_t length, const typename TImage::Value* values );
+
+  /**
+   * Sets a value to a row of an image, from a point along the first
+   * axis.
+   *
+   * @tparam TImage a model of concepts::CImage on an HyperRectDomain.
+   * @param[in,out] image the image.
+   * @param aPoint the first point of the row.
+   * @param length the number of points, such that the row is in the
+   * domain of the image.
+   * @param aValue the value.
+   */
+  template <typename TImage>
+  void fillRow( TImage & image, const typename TImage::Point & aPoint,
+                std::size_t length, const typename TImage::Value & aValue );
+
+  /**
+   * Copies the values of a block of an image in a buffer, in the order
+   * of the block domain (first coordinate first).
+   *
+   * The block is copied row by row (see getRow). A TiledImage is read
+   * tile by tile.
+   *
+   * @tparam TImage a model of concepts::CConstImage on an HyperRectDomain.
+   * @param image the image.
+   * @param aBlock a sub-domain of the domain of the image (possibly empty).
+   * @param[out] values a buffer of aBlock.size() values.
+   */
+  template <typename TImage>
+  void getBlock( const TImage & image, const typename TImage::Domain & aBlock,
+                 typename TImage::Value* values );
+
+  /**
+   * Sets the values of a block of an image from a buffer, in the order
+   * of the block domain (first coordinate first).
+   *
+   * @tparam TImage a model of concepts::CImage on an HyperRectDomain.
+   * @param[in,out] image the image.
+   * @param aBlock a sub-domain of the domain of the image (possibly empty).
+   * @param values a buffer of aBlock.size() values.
+   */
+  template <typename TImage>
+  void setBlock( TImage & image, const typename TImage::Domain & aBlock,
+                 const typename TImage::Value* values );
+
+  /**
+   * Sets a value to a block of an image.
+   *
+   * @tparam TImage a model of concepts::CImage on an HyperRectDomain.
+   * @param[in,out] image the image.
+   * @param aBlock a sub-domain of the domain of the image (possibly empty).
+   * @param aValue the value.
+   */
+  template <typename TImage>
+  void fillBlock( TImage & image, const typename TImage::Domain & aBlock,
+                  const typename TImage::Value & aValue );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageBlockAccess.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageBlockAccess_h
+
+#undef ImageBlockAccess_RECURSES
+#endif // else defined(ImageBlockAccess_RECURSES)
@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <atomic>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConceptUtils.h"
 #include "DGtal/images/CImage.h"
@@ -53,6 +54,22 @@
 namespace DGtal
 {   
 
+namespace detail
+{
+  /**
+   * Tells if a read policy declares a 'Concurrent' tag, in which case
+   * ImageCache reads and writes the values through the policy (see
+   * ImageCacheReadPolicyShardedLRU). Type is TagTrue or TagFalse.
+   */
+  template <typename TReadPolicy>
+  struct IsConcurrentReadPolicy
+  {
+    template <typename U> static TagTrue test( typename U::Concurrent* );
+    template <typename U> static TagFalse test( ... );
+    typedef decltype( test<TReadPolicy>( 0 ) ) Type;
+  };
+}
+
 // CACHE_READ_POLICY_LAST, CACHE_READ_POLICY_FIFO, CACHE_READ_POLICY_LRU, CACHE_READ_POLICY_NEIGHBORS   // read policies
 // CACHE_WRITE_POLICY_WT, CACHE_WRITE_POLICY_WB                                                         // write policies
     
@@ -98,6 +115,7 @@ public:
     
     typedef TReadPolicy ReadPolicy;
     typedef TWritePolicy WritePolicy;
+    typedef typename detail::IsConcurrentReadPolicy<ReadPolicy>::Type Concurrent;
 
     // ----------------------- Standard services ------------------------------
 
@@ -260,12 +278,30 @@ protected:
 private:
     
     /// cache miss values
-    unsigned int cacheMissRead;
-    unsigned int cacheMissWrite;
+    std::atomic<unsigned int> cacheMissRead;
+    std::atomic<unsigned int> cacheMissWrite;
 
     // ------------------------- Internals ------------------------------------
 private:
 
+    /// Reads with getPage.
+    bool read(const Point & aPoint, Value &aValue, TagFalse) const;
+
+    /// Reads through a concurrent read policy.
+    bool read(const Point & aPoint, Value &aValue, TagTrue) const;
+
+    /// Writes with getPage.
+    bool write(const Point & aPoint, const Value &aValue, TagFalse);
+
+    /// Writes through a concurrent read policy.
+    bool write(const Point & aPoint, const Value &aValue, TagTrue);
+
+    /// Detaches the page to detach, then updates the policy.
+    void update(const Domain &aDomain, TagFalse);
+
+    /// Updates the policy, then detaches the pages it replaced.
+    void update(const Domain &aDomain, TagTrue);
+
 }; // end of class ImageCache
 
 
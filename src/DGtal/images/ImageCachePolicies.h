@@ -41,11 +41,19 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConceptUtils.h"
 #include "DGtal/images/CImage.h"
 #include "DGtal/images/CImageFactory.h"
 #include "DGtal/base/Alias.h"
+#include "DGtal/kernel/PointHashFunctions.h"
 
 #include "DGtal/images/ImageCache.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -266,6 +274,660 @@ protected:
     
 }; // end of class ImageCacheReadPolicyFIFO
 
+namespace detail
+{
+  /**
+   * The regular grid of tiles of a TiledImage with N tiles per
+   * dimension, used by the read policies to find the tile containing
+   * a point with a hash lookup. A tile is identified by its lower
+   * bound.
+   *
+   * @tparam TDomain an HyperRectDomain.
+   */
+  template <typename TDomain>
+  struct ImageCacheTileGrid
+  {
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Integer Integer;
+
+    /**
+     * @param aDomain the domain of the tiled image.
+     * @param N the number of tiles per dimension.
+     */
+    ImageCacheTileGrid( const Domain & aDomain, Integer N )
+      : myLowerBound( aDomain.lowerBound() )
+    {
+      for ( Dimension i = 0; i < Domain::dimension; ++i )
+        mySize[ i ] = std::max( Integer( ( aDomain.upperBound()[ i ] - myLowerBound[ i ] + 1 ) / N ),
+                                Integer( 1 ) );
+    }
+
+    /// @return the lower bound of the tile containing aPoint.
+    Point key( const Point & aPoint ) const
+    {
+      Point k;
+      for ( Dimension i = 0; i < Domain::dimension; ++i )
+        k[ i ] = myLowerBound[ i ] + ( ( aPoint[ i ] - myLowerBound[ i ] ) / mySize[ i ] ) * mySize[ i ];
+      return k;
+    }
+
+    Point myLowerBound; ///< The lower bound of the image domain.
+    Point mySize;       ///< The size of the tiles.
+  };
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////////////
+// Template class ImageCacheReadPolicyLRU
+/**
+ * Description of template class 'ImageCacheReadPolicyLRU' <p>
+ * \brief Aim: implements a 'LRU' (least recently used) read policy
+ * cache, bounded by a number of bytes.
+ *
+ * The pages are kept in a list ordered by their last access and
+ * indexed by a hash table on the lower bound of their domain, so that
+ * finding the page of a point, accessing and replacing a page are done
+ * in constant time. When the pages take more than the byte budget,
+ * the least recently used page is selected for replacement.
+ *
+ * The pages are expected to be the tiles of a TiledImage with N tiles
+ * per dimension (the tiles are found from the points with this grid).
+ * The size of a page is the number of its values times
+ * sizeof(Value): one page is kept whatever the budget.
+ *
+ * The number of hits, misses and evictions are counted, in order to
+ * size the cache.
+ *
+ * @tparam TImageContainer an image container type (model of CImage).
+ * @tparam TImageFactory an image factory.
+ *
+ * @see ImageCacheReadPolicyLAST for the policy functions.
+ */
+template <typename TImageContainer, typename TImageFactory>
+class ImageCacheReadPolicyLRU
+{
+public:
+
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImageContainer> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CImageFactory<TImageFactory> ));
+
+    typedef TImageFactory ImageFactory;
+
+    typedef TImageContainer ImageContainer;
+    typedef typename TImageContainer::Domain Domain;
+    typedef typename TImageContainer::Point Point;
+    typedef typename TImageContainer::Value Value;
+
+    /**
+     * Constructor.
+     * @param anImageFactory alias on the image factory.
+     * @param aByteBudget the maximal number of bytes of the pages.
+     * @param N the number of tiles per dimension of the TiledImage.
+     */
+    ImageCacheReadPolicyLRU(Alias<ImageFactory> anImageFactory, std::size_t aByteBudget,
+                            typename Domain::Integer N):
+      myImageFactory(&anImageFactory), myGrid(myImageFactory->domain(), N),
+      myByteBudget(aByteBudget), myBytes(0), myMaxPageBytes(0)
+    {
+      resetCounters();
+    }
+
+    /**
+     * Destructor.
+     * Does nothing
+     */
+    ~ImageCacheReadPolicyLRU() {}
+
+private:
+
+    ImageCacheReadPolicyLRU( const ImageCacheReadPolicyLRU & other );
+
+    ImageCacheReadPolicyLRU & operator=( const ImageCacheReadPolicyLRU & other );
+
+public:
+
+    /**
+     * Get the alias on the image that contains the point aPoint
+     * or NULL if no image in the cache contains the point aPoint.
+     *
+     * @param aPoint the point.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPage(const Point & aPoint);
+
+    /**
+     * Get the alias on the image that matchs the domain aDomain
+     * or NULL if no image in the cache matchs the domain aDomain.
+     *
+     * @param aDomain the domain.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPage(const Domain & aDomain);
+
+    /**
+     * Get the alias on the image that we have to detach
+     * or NULL if no image have to be detached.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPageToDetach();
+
+    /**
+     * Update the cache according to the cache policy.
+     *
+     * @param aDomain the domain.
+     */
+    void updateCache(const Domain &aDomain);
+
+    /**
+     * Clear the cache.
+     */
+    void clearCache();
+
+    /// @return the maximal number of bytes of the pages.
+    std::size_t byteBudget() const { return myByteBudget; }
+
+    /// @return the number of bytes of the pages in the cache.
+    std::size_t nbBytes() const { return myBytes; }
+
+    /// @return the number of pages in the cache.
+    std::size_t nbPages() const { return myPages.size(); }
+
+    /// @return the number of page requests found in the cache.
+    std::size_t nbHits() const { return myHits; }
+
+    /// @return the number of page requests not found in the cache.
+    std::size_t nbMisses() const { return myMisses; }
+
+    /// @return the number of pages selected for replacement.
+    std::size_t nbEvictions() const { return myEvictions; }
+
+    /// Resets the hit, miss and eviction counters.
+    void resetCounters() { myHits = myMisses = myEvictions = 0; }
+
+protected:
+
+    /// A page of the cache.
+    struct Page
+    {
+      Point key;               ///< The lower bound of its domain.
+      ImageContainer * image;  ///< The image.
+      std::size_t bytes;       ///< Its size.
+    };
+    typedef std::list<Page> Pages;
+
+    /// Returns the page of key aKey, moved in front of the list, or NULL.
+    ImageContainer * touch(const Point & aKey);
+
+    /// Alias on the image factory
+    ImageFactory * myImageFactory;
+
+    /// The grid of tiles.
+    detail::ImageCacheTileGrid<Domain> myGrid;
+
+    /// The pages, from the most recently used one.
+    Pages myPages;
+
+    /// The pages indexed by their key.
+    std::unordered_map<Point, typename Pages::iterator> myIndex;
+
+    /// The maximal number of bytes of the pages.
+    std::size_t myByteBudget;
+
+    /// The number of bytes of the pages.
+    std::size_t myBytes;
+
+    /// The size of the largest page loaded, the expected size of the next one.
+    std::size_t myMaxPageBytes;
+
+    /// Counters.
+    std::size_t myHits, myMisses, myEvictions;
+
+}; // end of class ImageCacheReadPolicyLRU
+
+/////////////////////////////////////////////////////////////////////////////
+// Template class ImageCacheReadPolicyARC
+/**
+ * Description of template class 'ImageCacheReadPolicyARC' <p>
+ * \brief Aim: implements an 'ARC' (adaptive replacement cache) read
+ * policy cache, bounded by a number of bytes.
+ *
+ * Following Megiddo and Modha, the pages are split into a list T1 of
+ * pages accessed once and a list T2 of pages accessed several times,
+ * both in LRU order, and the keys of the pages recently replaced from
+ * them are remembered in the "ghost" lists B1 and B2. A miss on a key
+ * of B1 (resp. B2) increases (resp. decreases) the target size of T1,
+ * and a page is replaced from T1 when it is larger than its target,
+ * from T2 otherwise. The cache thus adapts between recency and
+ * frequency, and resists scans that would flush a LRU cache. Sizes
+ * and targets are counted in bytes instead of pages.
+ *
+ * As for ImageCacheReadPolicyLRU, the pages are the tiles of a
+ * TiledImage with N tiles per dimension, and hits, misses and
+ * evictions are counted.
+ *
+ * @tparam TImageContainer an image container type (model of CImage).
+ * @tparam TImageFactory an image factory.
+ *
+ * @see ImageCacheReadPolicyLAST for the policy functions.
+ */
+template <typename TImageContainer, typename TImageFactory>
+class ImageCacheReadPolicyARC
+{
+public:
+
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImageContainer> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CImageFactory<TImageFactory> ));
+
+    typedef TImageFactory ImageFactory;
+
+    typedef TImageContainer ImageContainer;
+    typedef typename TImageContainer::Domain Domain;
+    typedef typename TImageContainer::Point Point;
+    typedef typename TImageContainer::Value Value;
+
+    /**
+     * Constructor.
+     * @param anImageFactory alias on the image factory.
+     * @param aByteBudget the maximal number of bytes of the pages.
+     * @param N the number of tiles per dimension of the TiledImage.
+     */
+    ImageCacheReadPolicyARC(Alias<ImageFactory> anImageFactory, std::size_t aByteBudget,
+                            typename Domain::Integer N):
+      myImageFactory(&anImageFactory), myGrid(myImageFactory->domain(), N),
+      myByteBudget(aByteBudget), myTarget(0), myMaxPageBytes(0), myHasPending(false)
+    {
+      for (unsigned int i=0; i<4; i++) myBytes[i] = 0;
+      resetCounters();
+    }
+
+    /**
+     * Destructor.
+     * Does nothing
+     */
+    ~ImageCacheReadPolicyARC() {}
+
+private:
+
+    ImageCacheReadPolicyARC( const ImageCacheReadPolicyARC & other );
+
+    ImageCacheReadPolicyARC & operator=( const ImageCacheReadPolicyARC & other );
+
+public:
+
+    /**
+     * Get the alias on the image that contains the point aPoint
+     * or NULL if no image in the cache contains the point aPoint.
+     *
+     * @param aPoint the point.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPage(const Point & aPoint);
+
+    /**
+     * Get the alias on the image that matchs the domain aDomain
+     * or NULL if no image in the cache matchs the domain aDomain.
+     *
+     * @param aDomain the domain.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPage(const Domain & aDomain);
+
+    /**
+     * Get the alias on the image that we have to detach
+     * or NULL if no image have to be detached.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPageToDetach();
+
+    /**
+     * Update the cache according to the cache policy.
+     *
+     * @param aDomain the domain.
+     */
+    void updateCache(const Domain &aDomain);
+
+    /**
+     * Clear the cache.
+     */
+    void clearCache();
+
+    /// @return the maximal number of bytes of the pages.
+    std::size_t byteBudget() const { return myByteBudget; }
+
+    /// @return the number of bytes of the pages in the cache.
+    std::size_t nbBytes() const { return myBytes[T1] + myBytes[T2]; }
+
+    /// @return the number of pages in the cache.
+    std::size_t nbPages() const { return myLists[T1].size() + myLists[T2].size(); }
+
+    /// @return the target number of bytes of the pages accessed once.
+    std::size_t target() const { return myTarget; }
+
+    /// @return the number of page requests found in the cache.
+    std::size_t nbHits() const { return myHits; }
+
+    /// @return the number of page requests not found in the cache.
+    std::size_t nbMisses() const { return myMisses; }
+
+    /// @return the number of pages selected for replacement.
+    std::size_t nbEvictions() const { return myEvictions; }
+
+    /// Resets the hit, miss and eviction counters.
+    void resetCounters() { myHits = myMisses = myEvictions = 0; }
+
+protected:
+
+    /// The lists: pages accessed once or more, ghosts of the pages replaced from T1 or T2.
+    enum List { T1 = 0, T2 = 1, B1 = 2, B2 = 3 };
+
+    /// A page of the cache (with a NULL image in the ghost lists).
+    struct Page
+    {
+      Point key;               ///< The lower bound of its domain.
+      ImageContainer * image;  ///< The image.
+      std::size_t bytes;       ///< Its size.
+    };
+    typedef std::list<Page> Pages;
+
+    /// The position of a page in the lists.
+    struct Location
+    {
+      List list;
+      typename Pages::iterator it;
+    };
+
+    /// Returns the page of key aKey, moved in front of T2, or NULL if it is not in T1 or T2.
+    ImageContainer * touch(const Point & aKey);
+
+    /// Moves a page in front of another list.
+    void move(typename std::unordered_map<Point, Location>::iterator aLocation, List aList);
+
+    /// Forgets the least recently used ghost of B1 or B2.
+    void dropGhost(List aList);
+
+    /// Alias on the image factory
+    ImageFactory * myImageFactory;
+
+    /// The grid of tiles.
+    detail::ImageCacheTileGrid<Domain> myGrid;
+
+    /// The lists T1, T2, B1 and B2, from their most recently used page.
+    Pages myLists[4];
+
+    /// The number of bytes of each list.
+    std::size_t myBytes[4];
+
+    /// The pages indexed by their key.
+    std::unordered_map<Point, Location> myIndex;
+
+    /// The maximal number of bytes of the pages.
+    std::size_t myByteBudget;
+
+    /// The target number of bytes of T1.
+    std::size_t myTarget;
+
+    /// The size of the largest page loaded, the expected size of the next one.
+    std::size_t myMaxPageBytes;
+
+    /// The key of the last missed page, which is the next one to be loaded.
+    Point myPending;
+    bool myHasPending;
+
+    /// Counters.
+    std::size_t myHits, myMisses, myEvictions;
+
+}; // end of class ImageCacheReadPolicyARC
+
+/////////////////////////////////////////////////////////////////////////////
+// Template class ImageCacheReadPolicyShardedLRU
+/**
+ * Description of template class 'ImageCacheReadPolicyShardedLRU' <p>
+ * \brief Aim: implements a thread-safe 'LRU' read policy cache, bounded
+ * by a number of bytes, so that several threads may read a TiledImage
+ * concurrently.
+ *
+ * The pages are distributed in shards according to the hash of their
+ * key, each shard being an independent LRU cache (see
+ * ImageCacheReadPolicyLRU) with its own mutex and an equal share of
+ * the byte budget: threads accessing different shards do not wait for
+ * each other.
+ *
+ * Through ImageCache (thus TiledImage), reading or writing a value is
+ * done while the shard of its page is locked. A page is loaded by
+ * updateCache without holding the lock of its shard, which is taken
+ * again to insert it: if another thread loaded the same page in the
+ * meantime, the new copy is discarded. The pages evicted from a shard
+ * are removed from it under its lock by whichever thread evicts them,
+ * then queued to be detached (see getPageToDetach), so that they
+ * cannot be reached by other threads anymore. The image factory
+ * must accept concurrent requests. Concurrent writes need the 'WT'
+ * write policy, since a page replaced with unflushed values could be
+ * reloaded by another thread before being flushed. The pages returned
+ * by getPage may be replaced by other threads: TiledIterator is not
+ * thread-safe.
+ *
+ * As for ImageCacheReadPolicyLRU, the pages are the tiles of a
+ * TiledImage with N tiles per dimension, and hits, misses and
+ * evictions are counted.
+ *
+ * @tparam TImageContainer an image container type (model of CImage).
+ * @tparam TImageFactory an image factory.
+ *
+ * @see ImageCacheReadPolicyLAST for the policy functions.
+ */
+template <typename TImageContainer, typename TImageFactory>
+class ImageCacheReadPolicyShardedLRU
+{
+public:
+
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImageContainer> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CImageFactory<TImageFactory> ));
+
+    typedef TImageFactory ImageFactory;
+
+    typedef TImageContainer ImageContainer;
+    typedef typename TImageContainer::Domain Domain;
+    typedef typename TImageContainer::Point Point;
+    typedef typename TImageContainer::Value Value;
+
+    /// Tells ImageCache to access the values through the policy.
+    typedef TagTrue Concurrent;
+
+    /**
+     * Constructor.
+     * @param anImageFactory alias on the image factory.
+     * @param aByteBudget the maximal number of bytes of the pages.
+     * @param N the number of tiles per dimension of the TiledImage.
+     * @param aNbShards the number of shards.
+     */
+    ImageCacheReadPolicyShardedLRU(Alias<ImageFactory> anImageFactory, std::size_t aByteBudget,
+                                   typename Domain::Integer N, unsigned int aNbShards = 16);
+
+    /**
+     * Destructor.
+     * Does nothing
+     */
+    ~ImageCacheReadPolicyShardedLRU() {}
+
+private:
+
+    ImageCacheReadPolicyShardedLRU( const ImageCacheReadPolicyShardedLRU & other );
+
+    ImageCacheReadPolicyShardedLRU & operator=( const ImageCacheReadPolicyShardedLRU & other );
+
+public:
+
+    /**
+     * Get the alias on the image that contains the point aPoint
+     * or NULL if no image in the cache contains the point aPoint.
+     *
+     * @param aPoint the point.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPage(const Point & aPoint);
+
+    /**
+     * Get the alias on the image that matchs the domain aDomain
+     * or NULL if no image in the cache matchs the domain aDomain.
+     *
+     * @param aDomain the domain.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPage(const Domain & aDomain);
+
+    /**
+     * Get the alias on an image replaced by updateCache, that we have
+     * to detach, or NULL if no image have to be detached.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPageToDetach();
+
+    /**
+     * Update the cache according to the cache policy: loads the page
+     * of domain aDomain, unless another thread did, after having
+     * replaced pages of its shard if needed. The shard is not locked
+     * while the page is requested to the factory; a page loaded
+     * meanwhile by another thread is kept and ours is queued to be
+     * detached.
+     *
+     * @param aDomain the domain.
+     */
+    void updateCache(const Domain &aDomain);
+
+    /**
+     * Clear the cache.
+     */
+    void clearCache();
+
+    /**
+     * Get the value of the page containing aPoint, while its shard is locked.
+     *
+     * @param aPoint the point.
+     * @param aValue the value returned.
+     *
+     * @return 'true' if aPoint belongs to a page of the cache, 'false' otherwise.
+     */
+    bool read(const Point & aPoint, Value & aValue);
+
+    /**
+     * Set a value with a write policy on the page containing aPoint,
+     * while its shard is locked.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     * @param aWritePolicy the write policy.
+     *
+     * @return 'true' if aPoint belongs to a page of the cache, 'false' otherwise.
+     */
+    template <typename TWritePolicy>
+    bool write(const Point & aPoint, const Value & aValue, TWritePolicy & aWritePolicy);
+
+    /// @return the maximal number of bytes of the pages.
+    std::size_t byteBudget() const { return myByteBudget; }
+
+    /// @return the number of shards.
+    std::size_t nbShards() const { return myShards.size(); }
+
+    /// @return the number of bytes of the pages in the cache.
+    std::size_t nbBytes() const;
+
+    /// @return the number of pages in the cache.
+    std::size_t nbPages() const;
+
+    /// @return the number of page requests found in the cache.
+    std::size_t nbHits() const { return myHits; }
+
+    /// @return the number of page requests not found in the cache.
+    std::size_t nbMisses() const { return myMisses; }
+
+    /// @return the number of pages selected for replacement.
+    std::size_t nbEvictions() const { return myEvictions; }
+
+    /// Resets the hit, miss and eviction counters.
+    void resetCounters() { myHits = 0; myMisses = 0; myEvictions = 0; }
+
+protected:
+
+    /// A page of the cache.
+    struct Page
+    {
+      Point key;               ///< The lower bound of its domain.
+      ImageContainer * image;  ///< The image.
+      std::size_t bytes;       ///< Its size.
+    };
+    typedef std::list<Page> Pages;
+
+    /// A shard: an LRU cache with its lock.
+    struct Shard
+    {
+      std::mutex mutex;
+      Pages pages;
+      std::unordered_map<Point, typename Pages::iterator> index;
+      std::size_t bytes;
+    };
+
+    /// @return the shard of a page key.
+    Shard & shardOf(const Point & aKey) const;
+
+    /// Returns the page of key aKey in a locked shard, moved in front of its list, or NULL.
+    ImageContainer * touch(Shard & aShard, const Point & aKey);
+
+    /// Alias on the image factory
+    ImageFactory * myImageFactory;
+
+    /// The grid of tiles.
+    detail::ImageCacheTileGrid<Domain> myGrid;
+
+    /// The shards.
+    std::vector< std::unique_ptr<Shard> > myShards;
+
+    /// The maximal number of bytes of the pages.
+    std::size_t myByteBudget;
+
+    /// The replaced pages, waiting to be detached.
+    std::vector<ImageContainer *> myReplaced;
+
+    /// Protects myReplaced.
+    std::mutex myReplacedMutex;
+
+    /// Counters.
+    std::atomic<std::size_t> myHits, myMisses, myEvictions;
+
+}; // end of class ImageCacheReadPolicyShardedLRU
+
+template <typename TImageFactory>
+class AsyncImageFactory;
+
+namespace detail
+{
+  /// @return 'true' if the flushes of an image factory are done before
+  /// flushImage() returns, which is always the case except for an
+  /// AsyncImageFactory with asynchronous flush.
+  template <typename TImageFactory>
+  bool isSynchronousFlush( const TImageFactory & )
+  {
+    return true;
+  }
+
+  template <typename TImageFactory>
+  bool isSynchronousFlush( const AsyncImageFactory<TImageFactory> & anImageFactory )
+  {
+    return ! anImageFactory.isAsynchronousFlush();
+  }
+}
+
 /////////////////////////////////////////////////////////////////////////////
 // Template class ImageCacheWritePolicyWT
 /**
@@ -298,9 +960,17 @@ public:
     typedef typename TImageContainer::Point Point;
     typedef typename TImageContainer::Value Value;
     
+    /**
+     * Constructor.
+     * @param anImageFactory alias on the image factory.
+     * @pre the flushes of the factory are synchronous: pages are
+     * flushed while still in use (see AsyncImageFactory).
+     */
     ImageCacheWritePolicyWT(Alias<ImageFactory> anImageFactory):
       myImageFactory(&anImageFactory)
     {
+      ASSERT_MSG( detail::isSynchronousFlush( *myImageFactory ),
+                  "ImageCacheWritePolicyWT needs a synchronous flush" );
     }
 
     /**
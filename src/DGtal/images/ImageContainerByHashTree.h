@@ -42,6 +42,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CLabel.h"
 #include "DGtal/base/ConstRangeAdapter.h"
@@ -53,6 +54,7 @@
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/base/Bits.h"
 #include "DGtal/images/Morton.h"
+#include "DGtal/images/ImageBlockAccess.h"
 #include "DGtal/images/SetValueIterator.h"
 #include "DGtal/io/Color.h"
 #include "DGtal/base/ExpressionTemplates.h"
@@ -108,6 +110,19 @@ namespace DGtal
    * for an octree(N = 3) 1, 1000, 1010111 are valid keys, whereas 0,
    * 10, 11101 are not !
    *
+   * Nodes are stored in a flat open addressing table (linear
+   * probing, no allocation per node). A key is hashed by folding its
+   * bits onto its lowest ones, so that brother nodes, which only differ
+   * by their lowest bits, fall in consecutive slots of the same cache
+   * lines. The table grows to keep it at most half full: the hash
+   * key size given at construction is only its initial size.
+   *
+   * Several points are read at once with getValues(), which sorts them
+   * by Morton key so that consecutive points of a same leaf are
+   * resolved by a single walk up the tree. buildFromImage() builds the
+   * tree of a dense image by merging its uniform blocks bottom-up,
+   * level after level (in parallel with OpenMP).
+   *
    * Warning ! For performances this container's access method never
    * check for a key's validity.  Trying to access an invalid key may
    * destroy the validity of the tree's structure and/or get the
@@ -289,14 +304,17 @@ namespace DGtal
 
     /**
      * Give access to the underlying data.
-     * @return a (might be const) reference to the data.
+     * @note Before DGtal 1.3, it returned the array of chained lists
+     * (Node**) of the hash table.
+     * @return a (might be const) reference to the slots of the hash table
+     * (empty slots included).
     */
-    const Node** & data() const noexcept { return myData; };
+    const std::vector<Node> & data() const noexcept { return mySlots; };
     /**
      * Give access to the underlying data.
-     * @return a (might be const) reference to the data.
+     * @return a (might be const) reference to the slots of the hash table.
      */
-    Node** & data() noexcept { return myData; };
+    std::vector<Node> & data() noexcept { return mySlots; };
 
     /**
      * Returns the value corresponding to a key.
@@ -339,6 +357,40 @@ namespace DGtal
     Value get(const Point & aPoint) const;
 
 
+    /**
+     * Returns the values at several points, as get(const Point &)
+     * would. The points are sorted by Morton key so that the points
+     * of a same leaf share the walk up the tree, and sorted chunks are
+     * processed in parallel with OpenMP.
+     *
+     * @tparam TPointIterator a forward iterator on points.
+     * @tparam TOutputIterator an output iterator on values.
+     * @param itb an iterator on the first point.
+     * @param ite an iterator after the last point.
+     * @param out the values, written in the order of the points.
+     * @return the output iterator after the last value.
+     */
+    template <typename TPointIterator, typename TOutputIterator>
+    TOutputIterator getValues(TPointIterator itb, TPointIterator ite, TOutputIterator out) const;
+
+    /**
+     * Replaces the values of the container by the ones of a dense
+     * image. The leaves of the span are filled with the image values
+     * (the points outside of its domain get the value of aValue), then
+     * the blocks of 2^dim brother nodes of same value are merged,
+     * level after level up to the root. Each level is computed in
+     * parallel with OpenMP, and only two levels are stored at a time,
+     * i.e. about 1 + 1/2^dim times the number of points of the span.
+     *
+     * @tparam TImage a model of concepts::CConstImage whose domain is
+     * included in the domain of the container, and whose values
+     * convert to Value.
+     * @param anImage the image.
+     * @param aValue the value outside of the image domain.
+     */
+    template <typename TImage>
+    void buildFromImage(const TImage & anImage, const Value aValue = NumberTraits<Value>::ZERO);
+
     /**
      * Returns the value corresponding to a key making the assumption
      * that the key is at same depth or deeper than the leaf we are
@@ -476,26 +528,27 @@ namespace DGtal
     void printInfo(std::ostream& out) const;
 
     /**
-     * Returns the number of empty places in the hash table.
+     * Returns the number of empty slots in the hash table.
      */
     unsigned int getNbEmptyLists() const;
 
     /**
      * Returns The average number of collisions in the hash table,
-     * without counting the empty places.
+     * i.e. the average distance of the nodes to their hashed slot.
      */
     double getAverageCollisions() const;
 
     /**
-     * Returns the highest number of collisions in the hash table.
+     * Returns the highest number of collisions in the hash table,
+     * i.e. the highest distance of a node to its hashed slot.
      */
     unsigned int getMaxCollisions() const;
 
     /**
-     * Returns the number of elements for a given key of the hash
-     * table.
+     * Returns the number of elements hashed to a given slot of the
+     * hash table.
      *
-     * @param intermediateKey a hashtree key.
+     * @param intermediateKey a slot of the hash table.
      */
     unsigned int getNbNodes(unsigned int intermediateKey) const;
 
@@ -516,16 +569,13 @@ namespace DGtal
     class Iterator
     {
     public:
-      Iterator(Node** data, unsigned int position, unsigned int arraySize)
+      Iterator(Node* data, unsigned int position, unsigned int arraySize)
       {
         myArraySize = arraySize;
         myContainerData = data;
-        myNode = data[0];
         myCurrentCell = position;
-        while ((!myNode) && (myCurrentCell < myArraySize))
-          {
-            myNode = myContainerData[++myCurrentCell];
-          }
+        while ((myCurrentCell < myArraySize) && myContainerData[myCurrentCell].isEmpty())
+          ++myCurrentCell;
       }
       bool isAtEnd()const
       {
@@ -533,7 +583,7 @@ namespace DGtal
       }
       Value& operator*()
       {
-        return myNode->getObject();
+        return myContainerData[myCurrentCell].getObject();
       }
       bool operator ++ ()
       {
@@ -544,25 +594,21 @@ namespace DGtal
         if (isAtEnd() && it.isAtEnd())
           return true;
         else
-          return (myNode == it.myNode);
+          return (myCurrentCell == it.myCurrentCell);
       }
       bool operator != (const Iterator& it)
       {
-        if (isAtEnd() && it.isAtEnd())
-          return false;
-        else
-          return (myNode != it.myNode);
+        return !(*this == it);
       }
       inline HashKey getKey() const
       {
-        return myNode->getKey();
+        return myContainerData[myCurrentCell].getKey();
       }
       bool next();
     protected:
-      Node* myNode;
       unsigned int myCurrentCell;
       unsigned int myArraySize;
-      Node** myContainerData;
+      Node* myContainerData;
     };
 
     /**
@@ -570,7 +616,7 @@ namespace DGtal
      */
     Iterator begin()
     {
-      return Iterator(myData, 0, myArraySize);
+      return Iterator(mySlots.data(), 0, myArraySize);
     }
 
     /**
@@ -578,7 +624,7 @@ namespace DGtal
      */
     Iterator end()
     {
-      return Iterator(myData, myArraySize, myArraySize);
+      return Iterator(mySlots.data(), myArraySize, myArraySize);
     }
 
     void selfDisplay(std::ostream & out) const;
@@ -615,13 +661,21 @@ namespace DGtal
     /**
      * @class Node
      *
-     * An internal class that corresponds to a node of a linked list (as the hashTable points to linked
-     * lists to handle collisions). Each element in the container is placed in a Node.
+     * An internal class that corresponds to a slot of the hash table.
+     * Each element in the container is placed in a Node; empty slots
+     * have the key 0, which is not a valid key.
      */
     class Node
     {
     public:
 
+      /**
+       * Default constructor: an empty slot.
+       */
+      Node()
+        : myKey( 0 ), myData()
+      {}
+
       /**
        * Construtctor: create pair (@a aValue, @a key)
        *
@@ -635,53 +689,50 @@ namespace DGtal
       }
 
       /**
-       * @return the next pair (aValue, key) in the list.
+       * @return true if the slot is empty.
        */
-      inline Node* getNext()
+      inline bool isEmpty() const
       {
-        return myNext;
+        return myKey == 0;
       }
 
-
       /**
-       * Insert the pair (value,key)  @a next in the node list
        *
-       * @param next a pointer to a pair (value,key) (Node).
+       * @return the key associated to a Node.
        */
-      inline void setNext(Node* next)
+      inline HashKey getKey() const
       {
-        myNext = next;
+        return myKey;
       }
 
       /**
        *
-       * @return the key associated to a Node.
+       * @return the object (aValue) associated to a Node.
        */
-      inline HashKey getKey()
+      inline Value& getObject()
       {
-        return myKey;
+        return myData;
       }
 
       /**
        *
        * @return the object (aValue) associated to a Node.
        */
-      inline Value& getObject()
+      inline const Value& getObject() const
       {
         return myData;
       }
-      ~Node() { }
     protected:
       HashKey myKey;
-      Node* myNext;
       Value myData;
     };// -----------------------------------------------------------
 
 
     /**
      * This is part of the hash function. It is called whenever a key
-     * is accessed.  The mask used to compute the result is
-     * precomputed in the constructor for efficiency.
+     * is accessed: the bits of the key are folded onto its myKeySize
+     * lowest bits.  The mask used to compute the result is
+     * precomputed for efficiency.
      *
      * @param key a node in the hashtree.
      */
@@ -695,7 +746,7 @@ namespace DGtal
      *
      * @param object a object (value)
      * @param key a hashtree key
-     * @return a pointer to the node list.
+     * @return a pointer to the node, valid until the next insertion.
      */
     Node* addNode(const Value object, const HashKey key)
     {
@@ -703,14 +754,16 @@ namespace DGtal
       if (n)
         {
           n->getObject() = object;
-          //n->setObject(object);
           return n;
         }
-      n = new Node(object, key);
-      HashKey key2 = getIntermediateKey(key);
-      n->setNext(myData[key2]);
-      myData[key2] = n;
-      return n;
+      if ( 2 * ( myNbNodes + 1 ) > myArraySize )
+        resizeTable( myKeySize + 1 );
+      HashKey slot = getIntermediateKey(key);
+      while ( ! mySlots[ slot ].isEmpty() )
+        slot = ( slot + 1 ) & myPreComputedIntermediateMask;
+      mySlots[ slot ] = Node( object, key );
+      ++myNbNodes;
+      return &mySlots[ slot ];
     }
 
   public:
@@ -719,21 +772,36 @@ namespace DGtal
      * does'nt exist, returns 0.  This method is called VERY often,
      * and thus should operate as fast as possible.
      * @param key The key.
-     * @return the pointer to the node corresponding to the key.
+     * @return the pointer to the node corresponding to the key, valid
+     * until the next insertion.
      */
     inline Node* getNode(const HashKey key)  const  // very used !! // public because Display2DFactory !!!
     {
-      Node* iter = myData[getIntermediateKey(key)];
-      while (iter != 0)
+      HashKey slot = getIntermediateKey(key);
+      while ( true )
         {
-          if (iter->getKey() == key)
-            return iter;
-          iter = iter->getNext();
+          const Node & n = mySlots[ slot ];
+          if ( n.getKey() == key )
+            return const_cast<Node*>( &n );
+          if ( n.isEmpty() )
+            return 0;
+          slot = ( slot + 1 ) & myPreComputedIntermediateMask;
         }
-      return 0;
     }
   protected:
 
+    /**
+     * Rehashes the nodes in a table of 2^keySize slots.
+     * @param keySize the new size of the intermediate keys.
+     */
+    void resizeTable(unsigned int keySize);
+
+    /**
+     * Initializes an empty table of 2^keySize slots.
+     * @param keySize the size of the intermediate keys.
+     */
+    void initTable(unsigned int keySize);
+
     /**
      * Remove the node corresponding to a key. Returns false if the
      * node doesn't exist.
@@ -775,19 +843,23 @@ namespace DGtal
     Domain myDomain;
 
     /**
-     * The array of linked lists containing all the data
+     * The slots of the open addressing table containing all the data
      */
-    Node** myData;
+    std::vector<Node> mySlots;
 
     /**
-     * The size of the intermediate hashkey. The bigger the less
-     * collisions, but at the same time the more chances to have
-     * unused memory allocated.
+     * The size of the intermediate hashkey, i.e. the table has
+     * 2^myKeySize slots. It grows with the number of nodes.
      */
     unsigned int myKeySize;
 
     unsigned int myArraySize;
 
+    /**
+     * The number of nodes in the table.
+     */
+    std::size_t myNbNodes;
+
     /**
      * The depth of the tree
      */
@@ -0,0 +1,422 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByMappedFile.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module ImageContainerByMappedFile.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByMappedFile_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByMappedFile.h
+#else // defined(ImageContainerByMappedFile_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByMappedFile_RECURSES
+
+#if !defined ImageContainerByMappedFile_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByMappedFile_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <memory>
+#include <atomic>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CLabel.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/SetValueIterator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace detail
+  {
+    /**
+     * A file mapped in memory, read-only or copy-on-write (written
+     * pages are private to the mapping and never written back).
+     * Unmapped at destruction.
+     */
+    class MappedFile
+    {
+    public:
+      /// Mapping modes.
+      enum Mode { READ_ONLY, COPY_ON_WRITE };
+
+      /**
+       * Maps a whole file.
+       * @param filename a file name.
+       * @param aMode the mapping mode.
+       * @throw IOException if the file cannot be opened or mapped.
+       */
+      MappedFile( const std::string & filename, Mode aMode );
+
+      /// Unmaps the file.
+      ~MappedFile();
+
+      MappedFile( const MappedFile & ) = delete;
+      MappedFile & operator=( const MappedFile & ) = delete;
+
+      /// @return the first byte of the file.
+      unsigned char* data() const { return myData; }
+      /// @return the size of the file in bytes.
+      std::size_t size() const { return mySize; }
+      /// @return the mapping mode.
+      Mode mode() const { return myMode; }
+
+      /// Records that the mapped bytes have been written.
+      void setModified() { myModified = true; }
+
+      /**
+       * Maps the file again with the same mode, and copies the mapped
+       * bytes in the new mapping if they have been written (which
+       * then makes all its pages private).
+       * @return the new mapping, independent of this one.
+       * @throw IOException if the file cannot be mapped again.
+       */
+      std::shared_ptr<MappedFile> clone() const;
+
+    private:
+      unsigned char* myData; ///< First mapped byte (null for an empty file).
+      std::size_t mySize;    ///< Number of mapped bytes.
+      Mode myMode;           ///< Mapping mode.
+      std::string myFilename;///< Name of the mapped file.
+      std::atomic<bool> myModified; ///< True if the mapped bytes have been written.
+#ifdef WIN32
+      void* myFile;          ///< File handle.
+      void* myMapping;       ///< File mapping handle.
+#endif
+    };
+  } // namespace detail
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageContainerByMappedFile
+  /**
+   * Description of template class 'ImageContainerByMappedFile' <p>
+   * \brief Aim: Model of concepts::CImage whose values are read in a
+   * raw file (or in the payload of an uncompressed vol or longvol
+   * file) mapped in memory.
+   *
+   * Nothing is read at construction: the pages of the file are loaded
+   * by the system when their values are accessed, and are shared with
+   * the other processes mapping the same file. Opening a large volume
+   * is thus immediate, and only the region actually visited is read.
+   *
+   * Values are stored in the file in the order of the domain points
+   * (first coordinate first), like in ImageContainerBySTLVector, with
+   * the byte order of the host.
+   *
+   * The file is mapped read-only (setValue is then an error), or
+   * copy-on-write: modified values are kept in private pages and the
+   * file itself is never modified. The copies of a read-only image
+   * share its mapping, whereas a copy of a copy-on-write image maps
+   * the file again, so that the modifications of an image are never
+   * seen by its copies (copying a modified image copies its whole
+   * mapping, though).
+   *
+   * @code
+   * typedef ImageContainerByMappedFile<Z3i::Domain, unsigned char> Image;
+   * Image image = Image::importVol( "lobster.vol" );
+   * // only the pages containing the values of the slice are read.
+   * for ( auto p : Z3i::Domain( Z3i::Point( 0, 0, 40 ), Z3i::Point( 300, 300, 40 ) ) )
+   *   ... image( p ) ...
+   * @endcode
+   *
+   * @tparam TDomain an HyperRectDomain.
+   * @tparam TValue the type of the values, stored as is in the file.
+   *
+   * @see testImageContainerByMappedFile.cpp
+   */
+  template <typename TDomain, typename TValue>
+  class ImageContainerByMappedFile
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef ImageContainerByMappedFile<TDomain, TValue> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT(( concepts::CDomain<TDomain> ));
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    /// static constants
+    static const typename Domain::Dimension dimension = Domain::dimension;
+
+    /// range of values
+    BOOST_CONCEPT_ASSERT(( concepts::CLabel<TValue> ));
+    typedef TValue Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef DefaultImageRange<Self> Range;
+
+    /// output iterator
+    typedef SetValueIterator<Self> OutputIterator;
+
+    /// mapping modes
+    typedef detail::MappedFile::Mode Mode;
+    static const Mode READ_ONLY = detail::MappedFile::READ_ONLY;
+    static const Mode COPY_ON_WRITE = detail::MappedFile::COPY_ON_WRITE;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor from a raw file.
+     *
+     * @param filename the name of the file.
+     * @param aDomain the image domain.
+     * @param anOffset the position in bytes of the first value in the file.
+     * @param aMode READ_ONLY or COPY_ON_WRITE.
+     * @throw IOException if the file cannot be mapped or is too short.
+     */
+    ImageContainerByMappedFile( const std::string & filename,
+                                const Domain & aDomain,
+                                std::size_t anOffset = 0,
+                                Mode aMode = READ_ONLY );
+
+    /**
+     * Maps an uncompressed vol file (Version 2). Only the header is
+     * read.
+     *
+     * @pre Domain is 3-dimensional and Value is one byte long.
+     * @param filename the name of the file.
+     * @param aMode READ_ONLY or COPY_ON_WRITE.
+     * @return the image.
+     * @throw IOException if the header is invalid or the payload
+     * is compressed.
+     */
+    static Self importVol( const std::string & filename, Mode aMode = READ_ONLY );
+
+    /**
+     * Maps an uncompressed longvol file (Version 2). Only the header
+     * is read.
+     *
+     * @pre Domain is 3-dimensional and Value is 8 bytes long; the host
+     * is little endian.
+     * @param filename the name of the file.
+     * @param aMode READ_ONLY or COPY_ON_WRITE.
+     * @return the image.
+     * @throw IOException if the header is invalid or the payload
+     * is compressed.
+     */
+    static Self importLongvol( const std::string & filename, Mode aMode = READ_ONLY );
+
+    /**
+     * Copy constructor: a read-only mapping is shared, a
+     * copy-on-write one is cloned (see detail::MappedFile::clone).
+     * @param other the image to copy.
+     */
+    ImageContainerByMappedFile( const ImageContainerByMappedFile & other );
+
+    /**
+     * Assignment operator: a read-only mapping is shared, a
+     * copy-on-write one is cloned (see detail::MappedFile::clone).
+     * @param other the image to copy.
+     * @return a reference on 'this'.
+     */
+    ImageContainerByMappedFile & operator=( const ImageContainerByMappedFile & other );
+
+    /**
+     * Default move constructor: the mapping is transferred. The
+     * moved-from image has no mapping: it is not valid, its mode is
+     * READ_ONLY and it may only be assigned, copied, displayed or
+     * destroyed.
+     */
+    ImageContainerByMappedFile( ImageContainerByMappedFile && other ) = default;
+
+    /**
+     * Default move assignment operator: the mapping is transferred
+     * (see the move constructor for the moved-from image).
+     * @return a reference on 'this'.
+     */
+    ImageContainerByMappedFile & operator=( ImageContainerByMappedFile && other ) = default;
+
+    /**
+     * Destructor. The file is unmapped with its last image.
+     */
+    ~ImageContainerByMappedFile() = default;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Set a value on an Image at a position specified by a Point.
+     *
+     * @pre the point must be in the domain, and the file mapped
+     * copy-on-write.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue( const Point & aPoint, const Value & aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the const range providing constant
+     * iterators to iterate over the values of the image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing constant iterators
+     * and output iterators on the values of the image.
+     */
+    Range range();
+
+    /**
+     * @return an output iterator on the image, in the order of its domain.
+     */
+    OutputIterator outputIterator();
+
+    /**
+     * @return the extent of the image.
+     */
+    const Vector & extent() const;
+
+    /**
+     * @return the number of values of the image.
+     */
+    Size size() const;
+
+    /**
+     * @return the mapping mode (READ_ONLY for an image without mapping).
+     */
+    Mode mode() const;
+
+    /**
+     * @return the position in bytes of the first value in the file.
+     */
+    std::size_t offset() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The image domain.
+    Domain myDomain;
+    /// The extent of the domain.
+    Vector myExtent;
+    /// The mapped file, shared by the copies of a read-only image
+    /// (null once the image has been moved from).
+    std::shared_ptr<detail::MappedFile> myFile;
+    /// The position in bytes of the first value.
+    std::size_t myOffset;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return the address of its value (not necessarily aligned).
+     */
+    unsigned char* address( const Point & aPoint ) const;
+
+    /**
+     * @param aFile a mapping, possibly null.
+     * @return the mapping of a copy of an image mapped by \a aFile:
+     * itself if null or read-only, its clone otherwise.
+     */
+    static std::shared_ptr<detail::MappedFile>
+    copyMapping( const std::shared_ptr<detail::MappedFile> & aFile );
+
+    /**
+     * Reads the header of a vol or longvol file, with
+     * detail::BulkImageReader::readVolHeader as VolReader and
+     * LongvolReader.
+     *
+     * @param filename the name of the file.
+     * @param longvol true for a longvol file, false for a vol file.
+     * @param[out] aDomain the image domain.
+     * @param[out] anOffset the position of the first value.
+     * @throw IOException if the header is invalid or the payload
+     * is compressed.
+     */
+    static void readVolHeader( const std::string & filename, bool longvol,
+                               Domain & aDomain, std::size_t & anOffset );
+
+  }; // end of class ImageContainerByMappedFile
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByMappedFile'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByMappedFile' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageContainerByMappedFile<TDomain, TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerByMappedFile.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByMappedFile_h
+
+#undef ImageContainerByMappedFile_RECURSES
+#endif // else defined(ImageContainerByMappedFile_RECURSES)
@@ -0,0 +1,296 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByMortonOrder.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module ImageContainerByMortonOrder.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByMortonOrder_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByMortonOrder.h
+#else // defined(ImageContainerByMortonOrder_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByMortonOrder_RECURSES
+
+#if !defined ImageContainerByMortonOrder_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByMortonOrder_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <array>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CLabel.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/Morton.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/SetValueIterator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageContainerByMortonOrder
+  /**
+   * Description of template class 'ImageContainerByMortonOrder' <p>
+   * \brief Aim: Model of concepts::CImage storing its values in bricks
+   * of 4^d points, so that the neighbours of a point are close in
+   * memory along every axis.
+   *
+   * Inside a brick, values are ordered by the Morton code of their
+   * point (see Morton): the 2x2x2 sub-cubes are contiguous. Bricks
+   * are stored in the order of the domain (first coordinate first),
+   * the domain being padded to a multiple of 4 along each axis. In
+   * 3D, a brick of 64 values of one byte fits in a cache line, and the
+   * 26 neighbours of a point lie in at most 8 bricks, whereas they
+   * span 3 planes of the domain in ImageContainerBySTLVector.
+   *
+   * Since the Morton code of a point is the union of the bits
+   * interleaved from each coordinate, the index of a value is a sum
+   * of one precomputed offset per axis (see linearized): no
+   * multiplication nor bit interleaving is needed, and neighbours are
+   * reached by offsetting the coordinates in the same tables.
+   *
+   * The image can be used wherever a concepts::CImage is expected;
+   * ImageNeighbourhood visits the neighbours of a point whatever the
+   * layout of the image.
+   *
+   * @code
+   * ImageContainerByMortonOrder<Z3i::Domain, unsigned char> image( domain );
+   * ImageNeighbourhood< ImageContainerByMortonOrder<Z3i::Domain, unsigned char> >
+   *   neighbourhood( image, ImageNeighbourhood<...>::lInfNeighbours() );
+   * for ( auto it = neighbourhood.begin( p ), itE = neighbourhood.end( p ); it != itE; ++it )
+   *   ... *it ...
+   * @endcode
+   *
+   * @tparam TDomain an HyperRectDomain.
+   * @tparam TValue the type of the values.
+   *
+   * @see testImageContainerByMortonOrder.cpp
+   */
+  template <typename TDomain, typename TValue>
+  class ImageContainerByMortonOrder
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef ImageContainerByMortonOrder<TDomain, TValue> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT(( concepts::CDomain<TDomain> ));
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    /// static constants
+    static const typename Domain::Dimension dimension = Domain::dimension;
+    /// Number of points of a brick along each axis.
+    static const Integer brickWidth = 4;
+
+    /// range of values
+    BOOST_CONCEPT_ASSERT(( concepts::CLabel<TValue> ));
+    typedef TValue Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef DefaultImageRange<Self> Range;
+
+    /// output iterator
+    typedef SetValueIterator<Self> OutputIterator;
+
+    /// The storage of the values.
+    typedef std::vector<Value> Container;
+    typedef typename Container::reference Reference;
+    typedef typename Container::const_reference ConstReference;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param aDomain the image domain.
+     * @param aValue the initial value of the points.
+     */
+    ImageContainerByMortonOrder( const Domain & aDomain, const Value & aValue = Value() );
+
+    /**
+     * Default copy constructor.
+     */
+    ImageContainerByMortonOrder( const ImageContainerByMortonOrder & other ) = default;
+
+    /**
+     * Default assignment operator.
+     * @return a reference on 'this'.
+     */
+    ImageContainerByMortonOrder & operator=( const ImageContainerByMortonOrder & other ) = default;
+
+    /**
+     * Destructor.
+     */
+    ~ImageContainerByMortonOrder() = default;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Set a value on an Image at a position specified by a Point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue( const Point & aPoint, const Value & aValue );
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return the index of its value in the storage.
+     */
+    Size linearized( const Point & aPoint ) const;
+
+    /**
+     * @param anIndex an index returned by linearized.
+     * @return the value of this index.
+     */
+    ConstReference operator[]( Size anIndex ) const;
+
+    /**
+     * @param anIndex an index returned by linearized.
+     * @return the value of this index.
+     */
+    Reference operator[]( Size anIndex );
+
+    /**
+     * The offsets of the coordinates along an axis: the index of a
+     * point p is the sum of axisOffsets( k )[ p[ k ] - lower[ k ] ] over
+     * the axes k.
+     *
+     * @param k an axis.
+     * @return the offsets of the coordinates along this axis.
+     */
+    const std::vector<Size> & axisOffsets( Dimension k ) const;
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the const range providing constant
+     * iterators to iterate over the values of the image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing constant iterators
+     * and output iterators on the values of the image.
+     */
+    Range range();
+
+    /**
+     * @return an output iterator on the image, in the order of its domain.
+     */
+    OutputIterator outputIterator();
+
+    /**
+     * @return the extent of the image.
+     */
+    const Vector & extent() const;
+
+    /**
+     * @return the storage of the values, padding included.
+     */
+    const Container & container() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The image domain.
+    Domain myDomain;
+    /// The extent of the domain.
+    Vector myExtent;
+    /// The offsets of the coordinates along each axis.
+    std::array< std::vector<Size>, dimension > myAxisOffsets;
+    /// The values, brick after brick.
+    Container myValues;
+
+  }; // end of class ImageContainerByMortonOrder
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByMortonOrder'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByMortonOrder' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageContainerByMortonOrder<TDomain, TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerByMortonOrder.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByMortonOrder_h
+
+#undef ImageContainerByMortonOrder_RECURSES
+#endif // else defined(ImageContainerByMortonOrder_RECURSES)
@@ -55,6 +55,7 @@
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/images/ImageRowSpan.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -286,6 +287,28 @@ namespace DGtal
      */
     Range range();
 
+    /**
+     * Returns the values from a point to the end of its row along the
+     * first axis of the domain, which are contiguous in the container.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the first point of the span.
+     * @return a span of (upperBound()[0] - aPoint[0] + 1) values.
+     */
+    ImageRowSpan<Iterator> rowSpan ( const Point &aPoint );
+
+    /**
+     * Returns the values from a point to the end of its row along the
+     * first axis of the domain, which are contiguous in the container.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the first point of the span.
+     * @return a span of (upperBound()[0] - aPoint[0] + 1) values.
+     */
+    ImageRowSpan<ConstIterator> rowSpan ( const Point &aPoint ) const;
+
     /**
      * Give access to the underlying container.
      * @return a (might be const) reference to the container.
@@ -0,0 +1,222 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageFactoryFromBrickVol.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module ImageFactoryFromBrickVol.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageFactoryFromBrickVol_RECURSES)
+#error Recursive header files inclusion detected in ImageFactoryFromBrickVol.h
+#else // defined(ImageFactoryFromBrickVol_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageFactoryFromBrickVol_RECURSES
+
+#if !defined ImageFactoryFromBrickVol_h
+/** Prevents repeated inclusion of headers. */
+#define ImageFactoryFromBrickVol_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/io/BrickVolFile.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageFactoryFromBrickVol
+  /**
+   * Description of template class 'ImageFactoryFromBrickVol' <p>
+   * \brief Aim: implements a factory to produce images from a "brick
+   * vol" file (see BrickVolFile), reading only the bricks intersecting
+   * the requested domains.
+   *
+   * Used with a TiledImage whose tiles are the bricks of the file (the
+   * tile size, the domain extent divided by the number of tiles per
+   * axis, is the brick extent), each tile request reads and inflates
+   * one brick, directly in the storage of the tile when it is an
+   * ImageContainerBySTLVector. Other requests read the intersecting
+   * bricks in parallel.
+   *
+   * If the file is opened writable, flushImage compresses the bricks
+   * intersecting the flushed image and appends them to the file.
+   *
+   * @tparam TImageContainer an image container type (model of CImage),
+   * whose values have the type of the values of the file.
+   *
+   * \b Models: A ImageFactoryFromBrickVol is a model of concepts::CImageFactory.
+   */
+  template <typename TImageContainer>
+  class ImageFactoryFromBrickVol
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef ImageFactoryFromBrickVol<TImageContainer> Self;
+
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImageContainer> ));
+
+    ///Types copied from the container
+    typedef TImageContainer ImageContainer;
+    typedef typename ImageContainer::Domain Domain;
+    typedef typename ImageContainer::Value Value;
+
+    ///New types
+    typedef ImageContainer OutputImage;
+    typedef BrickVolFile<Domain, Value> File;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param filename the name of a brick vol file.
+     * @param writable if true, flushed images are written in the file.
+     */
+    ImageFactoryFromBrickVol( const std::string & filename, bool writable = false )
+      : myFile( filename, writable )
+    {
+    }
+
+    /**
+     * Destructor.
+     */
+    ~ImageFactoryFromBrickVol() {}
+
+  private:
+
+    ImageFactoryFromBrickVol( const ImageFactoryFromBrickVol & other );
+    ImageFactoryFromBrickVol & operator=( const ImageFactoryFromBrickVol & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /////////////////// Domains //////////////////
+
+    /**
+     * Returns a reference to the underlying image domain.
+     *
+     * @return a reference to the domain.
+     */
+    const Domain & domain() const
+    {
+      return myFile.domain();
+    }
+
+    /**
+     * @return the brick vol file.
+     */
+    const File & file() const
+    {
+      return myFile;
+    }
+
+    /////////////////// API //////////////////
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const
+    {
+      return myFile.isValid();
+    }
+
+    /**
+     * Returns a pointer of an OutputImage created with the domain
+     * aDomain, filled with the values of the file.
+     *
+     * @param aDomain the domain.
+     * @return an ImageContainer pointer.
+     */
+    OutputImage * requestImage( const Domain & aDomain )
+    {
+      OutputImage* outputImage = new OutputImage( aDomain );
+      myFile.readInto( *outputImage );
+      return outputImage;
+    }
+
+    /**
+     * Flush (i.e. write/synchronize) an OutputImage in the file.
+     *
+     * @pre the factory was constructed writable.
+     * @param outputImage the OutputImage.
+     */
+    void flushImage( OutputImage* outputImage )
+    {
+      myFile.writeFrom( *outputImage );
+    }
+
+    /**
+     * Free (i.e. delete) an OutputImage.
+     *
+     * @param outputImage the OutputImage.
+     */
+    void detachImage( OutputImage* outputImage )
+    {
+      delete outputImage;
+    }
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The brick vol file.
+    File myFile;
+
+  }; // end of class ImageFactoryFromBrickVol
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageFactoryFromBrickVol'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageFactoryFromBrickVol' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImageContainer>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageFactoryFromBrickVol<TImageContainer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageFactoryFromBrickVol.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageFactoryFromBrickVol_h
+
+#undef ImageFactoryFromBrickVol_RECURSES
+#endif // else defined(ImageFactoryFromBrickVol_RECURSES)
@@ -54,6 +54,7 @@
 #include "DGtal/images/CConstImage.h"
 #include "DGtal/images/ConstImageAdapter.h"
 #include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageBlockAccess.h"
 #include "DGtal/base/CQuantity.h"
 #include "DGtal/images/ImageContainerBySTLMap.h"
 #include "DGtal/images/SetValueIterator.h"
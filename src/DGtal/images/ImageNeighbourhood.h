@@ -0,0 +1,253 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageNeighbourhood.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module ImageNeighbourhood.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageNeighbourhood_RECURSES)
+#error Recursive header files inclusion detected in ImageNeighbourhood.h
+#else // defined(ImageNeighbourhood_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageNeighbourhood_RECURSES
+
+#if !defined ImageNeighbourhood_h
+/** Prevents repeated inclusion of headers. */
+#define ImageNeighbourhood_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/images/CConstImage.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageNeighbourhood
+  /**
+   * Description of template class 'ImageNeighbourhood' <p>
+   * \brief Aim: visits the values of the neighbours of a point in an
+   * image, the neighbours being given by a list of offsets.
+   *
+   * Only the image accesses of concepts::CConstImage are used, so that
+   * stencil algorithms written with this class work on any image
+   * layout, e.g. on ImageContainerBySTLVector or on the brick layout
+   * of ImageContainerByMortonOrder. The neighbours outside of the image
+   * domain are skipped; for the points whose whole neighbourhood is in
+   * the domain (see isInterior), which are most points of a volume,
+   * the domain is not tested at each neighbour.
+   *
+   * @code
+   * typedef ImageNeighbourhood<Image> Neighbourhood;
+   * Neighbourhood neighbourhood( image, Neighbourhood::lInfNeighbours() );
+   * for ( auto it = neighbourhood.begin( p ), itE = neighbourhood.end( p ); it != itE; ++it )
+   *   if ( *it > 0 ) ... it.point() ...
+   * @endcode
+   *
+   * @tparam TImage a model of concepts::CConstImage on an HyperRectDomain.
+   */
+  template <typename TImage>
+  class ImageNeighbourhood
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CConstImage<TImage> ));
+
+    // ----------------------- Types ------------------------------
+  public:
+    typedef ImageNeighbourhood<TImage> Self;
+    typedef TImage Image;
+    typedef typename Image::Domain Domain;
+    typedef typename Image::Point Point;
+    typedef typename Image::Value Value;
+    typedef typename Point::Coordinate Coordinate;
+    typedef typename Point::Dimension Dimension;
+    typedef typename Domain::Space::Vector Vector;
+    typedef std::vector<Vector> Offsets;
+
+    /**
+     * Forward iterator on the values of the neighbours of a point that
+     * lie in the image domain.
+     */
+    class ConstIterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef typename ImageNeighbourhood::Value value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const value_type* pointer;
+      typedef value_type reference;
+
+      /// Default constructor.
+      ConstIterator()
+        : myNeighbourhood( nullptr ), myIndex( 0 ), myInterior( true )
+      {}
+
+      /**
+       * Constructor.
+       * @param aNeighbourhood the neighbourhood.
+       * @param aPoint the center point.
+       * @param anIndex the index of the first offset to visit.
+       */
+      ConstIterator( const ImageNeighbourhood * aNeighbourhood, const Point & aPoint,
+                     std::size_t anIndex );
+
+      /// @return the value of the current neighbour.
+      value_type operator*() const;
+
+      /// @return the current neighbour.
+      Point point() const;
+
+      /// @return the index of the offset of the current neighbour.
+      std::size_t index() const
+      {
+        return myIndex;
+      }
+
+      /// Goes to the next neighbour in the domain.
+      ConstIterator & operator++();
+
+      /// Goes to the next neighbour in the domain.
+      ConstIterator operator++( int );
+
+      bool operator==( const ConstIterator & other ) const
+      {
+        return myIndex == other.myIndex;
+      }
+
+      bool operator!=( const ConstIterator & other ) const
+      {
+        return myIndex != other.myIndex;
+      }
+
+    private:
+      /// Skips the offsets leading outside of the domain.
+      void skip();
+
+      const ImageNeighbourhood * myNeighbourhood; ///< The visited neighbourhood.
+      Point myCenter;                               ///< The center point.
+      std::size_t myIndex;                          ///< The index of the current offset.
+      bool myInterior;                              ///< True if all neighbours are in the domain.
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param anImage the image whose values are visited (aliased).
+     * @param someOffsets the offsets of the neighbours.
+     */
+    ImageNeighbourhood( ConstAlias<Image> anImage, const Offsets & someOffsets );
+
+    /**
+     * @return the 2d offsets of the neighbours at l1 distance 1 (6
+     * neighbours in 3D).
+     */
+    static Offsets l1Neighbours();
+
+    /**
+     * @return the 3^d-1 offsets of the neighbours at linf distance 1
+     * (26 neighbours in 3D).
+     */
+    static Offsets lInfNeighbours();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /// @return the visited image.
+    const Image & image() const;
+
+    /// @return the offsets of the neighbours.
+    const Offsets & offsets() const;
+
+    /**
+     * @param aPoint a point.
+     * @return true if all the neighbours of aPoint are in the image domain.
+     */
+    bool isInterior( const Point & aPoint ) const;
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return an iterator on the first neighbour of aPoint in the domain.
+     */
+    ConstIterator begin( const Point & aPoint ) const;
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return an iterator after the last neighbour of aPoint.
+     */
+    ConstIterator end( const Point & aPoint ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The visited image.
+    const Image * myImage;
+    /// The offsets of the neighbours.
+    Offsets myOffsets;
+    /// The bounds of the points whose neighbours are all in the domain.
+    Point myInteriorLower, myInteriorUpper;
+
+  }; // end of class ImageNeighbourhood
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageNeighbourhood'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageNeighbourhood' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImage>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageNeighbourhood<TImage> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageNeighbourhood.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageNeighbourhood_h
+
+#undef ImageNeighbourhood_RECURSES
+#endif // else defined(ImageNeighbourhood_RECURSES)
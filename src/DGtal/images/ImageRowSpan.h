@@ -0,0 +1,154 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageRowSpan.h
+ *
+ * @date 2026/10/18
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageRowSpan_RECURSES)
+#error Recursive header files inclusion detected in ImageRowSpan.h
+#else // defined(ImageRowSpan_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageRowSpan_RECURSES
+
+#if !defined ImageRowSpan_h
+/** Prevents repeated inclusion of headers. */
+#define ImageRowSpan_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstddef>
+#include <iterator>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageRowSpan
+  /**
+   * Description of template class 'ImageRowSpan' <p>
+   * \brief Aim: a run of consecutive values of an image along its
+   * first axis, stored contiguously, as returned by the rowSpan()
+   * methods of ImageContainerBySTLVector and ArrayImageAdapter.
+   *
+   * The span is a view on the storage of the image: it is invalidated
+   * when the image is resized or destroyed.
+   *
+   * @tparam TIterator a random access iterator on the values (a
+   * pointer for images stored in a std::vector).
+   *
+   * @see ImageBlockAccess.h
+   */
+  template <typename TIterator>
+  class ImageRowSpan
+  {
+  public:
+    typedef TIterator Iterator;
+    typedef typename std::iterator_traits<Iterator>::reference Reference;
+    typedef std::size_t Size;
+
+    /**
+     * Constructor.
+     * @param aBegin an iterator on the first value of the run.
+     * @param aSize the number of values of the run.
+     */
+    ImageRowSpan( Iterator aBegin, Size aSize )
+      : myBegin( aBegin ), mySize( aSize )
+    {}
+
+    /// @return an iterator on the first value.
+    Iterator begin() const
+    {
+      return myBegin;
+    }
+
+    /// @return an iterator after the last value.
+    Iterator end() const
+    {
+      return myBegin + mySize;
+    }
+
+    /// @return the number of values.
+    Size size() const
+    {
+      return mySize;
+    }
+
+    /**
+     * @param i an index, lower than size().
+     * @return the i-th value of the run.
+     */
+    Reference operator[]( Size i ) const
+    {
+      ASSERT( i < mySize );
+      return myBegin[ i ];
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const
+    {
+      out << "[ImageRowSpan] " << mySize << " values";
+    }
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const
+    {
+      return true;
+    }
+
+  private:
+    Iterator myBegin; ///< The first value.
+    Size mySize;      ///< The number of values.
+  }; // end of class ImageRowSpan
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageRowSpan'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageRowSpan' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TIterator>
+  inline
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageRowSpan<TIterator> & object )
+  {
+    object.selfDisplay( out );
+    return out;
+  }
+
+} // namespace DGtal
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageRowSpan_h
+
+#undef ImageRowSpan_RECURSES
+#endif // else defined(ImageRowSpan_RECURSES)
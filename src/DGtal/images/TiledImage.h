@@ -41,6 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <unordered_map>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConceptUtils.h"
 #include "DGtal/images/CImage.h"
@@ -50,6 +52,9 @@
 #include "DGtal/base/Alias.h"
 
 #include "DGtal/images/ImageCache.h"
+#include "DGtal/images/ImageBlockAccess.h"
+#include "DGtal/kernel/PointHashFunctions.h"
+#include "DGtal/kernel/domains/Linearizer.h"
 
 #include "DGtal/base/TiledImageBidirectionalConstRangeFromPoint.h"
 #include "DGtal/base/TiledImageBidirectionalRangeFromPoint.h"
@@ -57,6 +62,22 @@
 
 namespace DGtal
 {
+  namespace detail
+  {
+    /**
+     * Tells if an image factory declares a 'Prefetching' tag, in which
+     * case TiledImage asks it to prefetch the next tiles (see
+     * AsyncImageFactory). Type is TagTrue or TagFalse.
+     */
+    template <typename TImageFactory>
+    struct IsPrefetchingImageFactory
+    {
+      template <typename U> static TagTrue test( typename U::Prefetching* );
+      template <typename U> static TagFalse test( ... );
+      typedef decltype( test<TImageFactory>( 0 ) ) Type;
+    };
+  }
+
   /////////////////////////////////////////////////////////////////////////////
   // Template class TiledImage
   /**
@@ -91,6 +112,7 @@ namespace DGtal
     typedef TImageContainer ImageContainer;
     typedef typename ImageContainer::Domain Domain;
     typedef typename ImageContainer::Point Point;
+    typedef typename Domain::Vector Vector;
     typedef typename ImageContainer::Value Value;
 
     typedef typename ImageContainer::Difference Difference;
@@ -118,7 +140,8 @@ namespace DGtal
                Alias<ImageCacheReadPolicy> aReadPolicy,
                Alias<ImageCacheWritePolicy> aWritePolicy,
                typename Domain::Integer N):
-      myN(N), myImageFactory(&anImageFactory), myReadPolicy(&aReadPolicy), myWritePolicy(&aWritePolicy)
+      myN(N), myImageFactory(&anImageFactory), myReadPolicy(&aReadPolicy), myWritePolicy(&aWritePolicy),
+      myPrefetchDepth(0), myAccessPlanCursor(0)
     {
       myImageCache = new MyImageCache(myImageFactory, myReadPolicy, myWritePolicy);
 
@@ -151,6 +174,10 @@ namespace DGtal
       myImageFactory = other.myImageFactory;
       myReadPolicy = other.myReadPolicy;
       myWritePolicy = other.myWritePolicy;
+      myPrefetchDepth = other.myPrefetchDepth;
+      myAccessPlan = other.myAccessPlan;
+      myAccessPlanIndex = other.myAccessPlanIndex;
+      myAccessPlanCursor = 0;
 
       myImageCache = new MyImageCache(myImageFactory, myReadPolicy, myWritePolicy);
 
@@ -174,6 +201,10 @@ namespace DGtal
           myImageFactory = other.myImageFactory;
           myReadPolicy = other.myReadPolicy;
           myWritePolicy = other.myWritePolicy;
+          myPrefetchDepth = other.myPrefetchDepth;
+          myAccessPlan = other.myAccessPlan;
+          myAccessPlanIndex = other.myAccessPlanIndex;
+          myAccessPlanCursor = 0;
 
           myImageCache = new MyImageCache(myImageFactory, myReadPolicy, myWritePolicy);
 
@@ -686,6 +717,7 @@ namespace DGtal
       ASSERT(domainBlockCoords().isInside(aCoord));
 
       Domain d = findSubDomainFromBlockCoords( aCoord );
+      prefetchAfter( aCoord );
       ImageContainer *tile = myImageCache->getPage(d);
       if (!tile)
         {
@@ -722,10 +754,14 @@ namespace DGtal
           trace.info()<<"+";
 #endif 
           d = findSubDomain(aPoint);
+          if (!myAccessPlan.empty())
+            prefetchAfter( findBlockCoordsFromPoint(aPoint) );
 
           myImageCache->update(d);
 
-          myImageCache->read(aPoint, aValue);
+          // With a concurrent read policy, the page may have been replaced meanwhile.
+          while (!myImageCache->read(aPoint, aValue))
+            myImageCache->update(d);
 
           return aValue;
         }
@@ -749,8 +785,97 @@ namespace DGtal
       else
         {
           myImageCache->incCacheMissWrite();
-          myImageCache->update(findSubDomain(aPoint));
-          myImageCache->write(aPoint, aValue);
+          const Domain d = findSubDomain(aPoint);
+          if (!myAccessPlan.empty())
+            prefetchAfter( findBlockCoordsFromPoint(aPoint) );
+          myImageCache->update(d);
+          while (!myImageCache->write(aPoint, aValue))
+            myImageCache->update(d);
+        }
+    }
+
+    /**
+     * Copies the values of a block in a buffer, in the order of the
+     * block domain (first coordinate first). The tiles intersecting
+     * the block are read one after the other, by rows.
+     *
+     * @param aBlock a sub-domain of the image domain (possibly empty).
+     * @param[out] values a buffer of aBlock.size() values.
+     *
+     * @see DGtal::getBlock
+     */
+    void getBlock(const Domain & aBlock, Value * values) const
+    {
+      if (aBlock.isEmpty())
+        return;
+      ASSERT(domain().isInside(aBlock.lowerBound()) && domain().isInside(aBlock.upperBound()));
+
+      const Vector extent = aBlock.upperBound() - aBlock.lowerBound() + Vector::diagonal(1);
+      for (const Point & coord : blockCoordsOf(aBlock))
+        {
+          const Domain part = tilePart(coord, aBlock);
+          const ImageContainer * tile = findTileFromBlockCoords(coord);
+          const std::size_t length = part.upperBound()[0] - part.lowerBound()[0] + 1;
+          for (const Point & row : detail::rowStarts(part))
+            DGtal::getRow(*tile, row, length,
+                          values + Linearizer<Domain, ColMajorStorage>::getIndex(row, aBlock.lowerBound(), extent));
+        }
+    }
+
+    /**
+     * Sets the values of a block from a buffer, in the order of the
+     * block domain (first coordinate first). The tiles intersecting
+     * the block are written one after the other, by rows, and the last
+     * value of each tile goes through the write policy, so that a
+     * write-through policy flushes each tile once.
+     *
+     * @param aBlock a sub-domain of the image domain (possibly empty).
+     * @param values a buffer of aBlock.size() values.
+     *
+     * @see DGtal::setBlock
+     */
+    void setBlock(const Domain & aBlock, const Value * values)
+    {
+      if (aBlock.isEmpty())
+        return;
+      ASSERT(domain().isInside(aBlock.lowerBound()) && domain().isInside(aBlock.upperBound()));
+
+      const Vector extent = aBlock.upperBound() - aBlock.lowerBound() + Vector::diagonal(1);
+      for (const Point & coord : blockCoordsOf(aBlock))
+        {
+          const Domain part = tilePart(coord, aBlock);
+          ImageContainer * tile = findTileFromBlockCoords(coord);
+          const std::size_t length = part.upperBound()[0] - part.lowerBound()[0] + 1;
+          for (const Point & row : detail::rowStarts(part))
+            DGtal::setRow(*tile, row, length,
+                          values + Linearizer<Domain, ColMajorStorage>::getIndex(row, aBlock.lowerBound(), extent));
+          myWritePolicy->writeInPage(tile, part.upperBound(),
+                                     values[Linearizer<Domain, ColMajorStorage>::getIndex(part.upperBound(), aBlock.lowerBound(), extent)]);
+        }
+    }
+
+    /**
+     * Sets a value to a block, tile by tile (see setBlock).
+     *
+     * @param aBlock a sub-domain of the image domain (possibly empty).
+     * @param aValue the value.
+     *
+     * @see DGtal::fillBlock
+     */
+    void fillBlock(const Domain & aBlock, const Value & aValue)
+    {
+      if (aBlock.isEmpty())
+        return;
+      ASSERT(domain().isInside(aBlock.lowerBound()) && domain().isInside(aBlock.upperBound()));
+
+      for (const Point & coord : blockCoordsOf(aBlock))
+        {
+          const Domain part = tilePart(coord, aBlock);
+          ImageContainer * tile = findTileFromBlockCoords(coord);
+          const std::size_t length = part.upperBound()[0] - part.lowerBound()[0] + 1;
+          for (const Point & row : detail::rowStarts(part))
+            DGtal::fillRow(*tile, row, length, aValue);
+          myWritePolicy->writeInPage(tile, part.upperBound(), aValue);
         }
     }
 
@@ -778,6 +903,39 @@ namespace DGtal
       myImageCache->clearCacheAndResetCacheMisses();
     }
 
+    /**
+     * Sets the prefetching of tiles, when the image factory accepts
+     * prefetch requests (see AsyncImageFactory), and does nothing
+     * otherwise.
+     *
+     * Each time a tile is reached by a TiledIterator, the factory is
+     * asked to load the next aDepth tiles in the order of the
+     * iteration. With an access plan, a list of block coords, the next
+     * tiles are instead the ones following the current tile in the
+     * plan, and the tiles loaded on a cache miss of operator() and
+     * setValue are also followed by their next tiles in the plan.
+     *
+     * @param aDepth the number of tiles to prefetch (0 disables prefetching).
+     * @param anAccessPlan the block coords of the tiles, in their order of access.
+     */
+    void setPrefetching(unsigned int aDepth, const std::vector<Point> & anAccessPlan = std::vector<Point>())
+    {
+      myPrefetchDepth = aDepth;
+      myAccessPlan = anAccessPlan;
+      myAccessPlanIndex.clear();
+      for (std::size_t i = anAccessPlan.size(); i > 0; i--)
+        myAccessPlanIndex[anAccessPlan[i-1]] = i-1; // first occurrence
+      myAccessPlanCursor = 0;
+    }
+
+    /**
+     * @return the number of tiles to prefetch.
+     */
+    unsigned int prefetchingDepth() const
+    {
+      return myPrefetchDepth;
+    }
+
     // ------------------------- Private Datas --------------------------------
   protected:
 
@@ -802,7 +960,93 @@ namespace DGtal
     /// TImageCacheWritePolicy pointer
     TImageCacheWritePolicy *myWritePolicy;
 
+    /// Number of tiles to prefetch
+    unsigned int myPrefetchDepth;
+
+    /// Block coords of the tiles in their order of access (empty for the iteration order)
+    std::vector<Point> myAccessPlan;
+
+    /// Position of the first occurrence of block coords in the access plan
+    std::unordered_map<Point, std::size_t> myAccessPlanIndex;
+
+    /// Position in the access plan following the last tile reached
+    mutable std::size_t myAccessPlanCursor;
+
     // ------------------------- Internals ------------------------------------
+  private:
+
+    typedef typename detail::IsPrefetchingImageFactory<ImageFactory>::Type Prefetching;
+
+    /**
+     * @param aBlock a non-empty sub-domain of the image domain.
+     * @return the domain of the block coords of the tiles intersecting aBlock.
+     */
+    Domain blockCoordsOf(const Domain & aBlock) const
+    {
+      return Domain(findBlockCoordsFromPoint(aBlock.lowerBound()),
+                    findBlockCoordsFromPoint(aBlock.upperBound()));
+    }
+
+    /**
+     * @param aCoord the block coords of a tile intersecting aBlock.
+     * @param aBlock a sub-domain of the image domain.
+     * @return the intersection of the tile with aBlock.
+     */
+    Domain tilePart(const Point & aCoord, const Domain & aBlock) const
+    {
+      const Domain tile = findSubDomainFromBlockCoords(aCoord);
+      return Domain(tile.lowerBound().sup(aBlock.lowerBound()),
+                    tile.upperBound().inf(aBlock.upperBound()));
+    }
+
+    /**
+     * Asks the image factory to prefetch the tiles following the tile
+     * of block coords aCoord.
+     *
+     * @param aCoord the block coords.
+     */
+    void prefetchAfter(const Point & aCoord) const
+    {
+      if (myPrefetchDepth == 0)
+        return;
+
+      if (!myAccessPlan.empty())
+        {
+          std::size_t k;
+          if (myAccessPlanCursor < myAccessPlan.size() && myAccessPlan[myAccessPlanCursor] == aCoord)
+            k = myAccessPlanCursor;
+          else
+            {
+              typename std::unordered_map<Point, std::size_t>::const_iterator it = myAccessPlanIndex.find(aCoord);
+              if (it == myAccessPlanIndex.end())
+                return;
+              k = it->second;
+            }
+          myAccessPlanCursor = k+1;
+          for (std::size_t i = k+1; i < myAccessPlan.size() && i <= k+myPrefetchDepth; i++)
+            prefetch(findSubDomainFromBlockCoords(myAccessPlan[i]), Prefetching());
+        }
+      else
+        {
+          const Domain blocks = domainBlockCoords();
+          typename Domain::ConstIterator it = blocks.begin(aCoord);
+          const typename Domain::ConstIterator itEnd = blocks.end();
+          ++it;
+          for (unsigned int n = 0; n < myPrefetchDepth && it != itEnd; n++, ++it)
+            prefetch(findSubDomainFromBlockCoords(*it), Prefetching());
+        }
+    }
+
+    /// Prefetches a tile.
+    void prefetch(const Domain & aDomain, TagTrue) const
+    {
+      myImageFactory->prefetch(aDomain);
+    }
+
+    /// Factories without prefetching.
+    void prefetch(const Domain &, TagFalse) const
+    {
+    }
 
   }; // end of class TiledImage
 
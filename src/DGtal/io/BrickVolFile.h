@@ -0,0 +1,375 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BrickVolFile.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module BrickVolFile.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BrickVolFile_RECURSES)
+#error Recursive header files inclusion detected in BrickVolFile.h
+#else // defined(BrickVolFile_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BrickVolFile_RECURSES
+
+#if !defined BrickVolFile_h
+/** Prevents repeated inclusion of headers. */
+#define BrickVolFile_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <cstdio>
+#include <cstddef>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BrickVolFile
+  /**
+   * Description of template class 'BrickVolFile' <p>
+   * \brief Aim: gives random access to the bricks of a "brick vol"
+   * file, an image format where the domain is cut into bricks that are
+   * compressed independently.
+   *
+   * The bricks form a regular grid starting at the lower bound of the
+   * domain, the last bricks along each axis being clipped to the
+   * domain (this is also the tiling of TiledImage, so that a tile is
+   * a brick when the brick extent is the tile size). The values of a
+   * brick are stored in the order of its domain (first coordinate
+   * first), either as is (RAW) or compressed with zlib (ZLIB).
+   *
+   * A file starts with a text header of "Field: value" lines ended by
+   * a line with a single dot:
+   * @code
+   * Brick-Vol: 1
+   * Dimension: 3
+   * Lower: 0 0 0
+   * Upper: 511 511 255
+   * Brick: 64 64 64
+   * Value-Size: 1
+   * Byte-Order: little
+   * Codec: zlib
+   * .
+   * @endcode
+   * followed by the brick index (for each brick, in the order of the
+   * grid of bricks, its position in the file and its size in bytes as
+   * two 64 bits integers, a null size meaning a brick of zeros), then
+   * by the bricks. Values and index are in the byte order of the
+   * header.
+   *
+   * Reading a brick only seeks to its position and inflates it, so
+   * that a region of interest is read without decoding the whole
+   * file. A modified brick overwrites its previous version when it
+   * fits in the bytes the brick occupied so far, and is otherwise
+   * appended at the end of the file, its previous bytes remaining
+   * unused. Importing the file with BrickVolReader and exporting it
+   * again with BrickVolWriter removes these unused bytes.
+   *
+   * readBrick and writeBrick may be called concurrently: only the file
+   * accesses are serialized, compression is not.
+   *
+   * @tparam TDomain an HyperRectDomain.
+   * @tparam TValue the type of values, stored as is.
+   *
+   * @see BrickVolReader, BrickVolWriter, ImageFactoryFromBrickVol
+   */
+  template <typename TDomain, typename TValue>
+  class BrickVolFile
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef BrickVolFile<TDomain, TValue> Self;
+    typedef TDomain Domain;
+    typedef TValue Value;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Size Size;
+    typedef DGtal::uint64_t Word;
+
+    /// Brick compression codecs.
+    enum Codec { RAW = 0, ZLIB = 1 };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Opens an existing file.
+     *
+     * @param filename the name of the file.
+     * @param writable if true, bricks may be written in the file.
+     * @throw IOException if the file cannot be opened or if its
+     * header does not match TDomain and TValue.
+     */
+    BrickVolFile( const std::string & filename, bool writable = false );
+
+    /**
+     * Creates a file, with bricks of zeros, and opens it for writing.
+     *
+     * @param filename the name of the file.
+     * @param aDomain the image domain.
+     * @param aBrickExtent the extent of the bricks.
+     * @param aCodec the codec of the bricks.
+     * @param aLevel the zlib compression level (from 1 to 9).
+     * @throw IOException if the file cannot be created.
+     */
+    BrickVolFile( const std::string & filename, const Domain & aDomain,
+                  const Vector & aBrickExtent, Codec aCodec = ZLIB, int aLevel = 6 );
+
+    /**
+     * Destructor, closes the file.
+     */
+    ~BrickVolFile();
+
+    BrickVolFile( const BrickVolFile & other ) = delete;
+    BrickVolFile & operator=( const BrickVolFile & other ) = delete;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /// @return the domain of the image.
+    const Domain & domain() const;
+
+    /// @return the extent of the bricks (but the clipped ones).
+    const Vector & brickExtent() const;
+
+    /// @return the number of bricks along each axis.
+    const Vector & gridExtent() const;
+
+    /// @return the number of bricks.
+    std::size_t nbBricks() const;
+
+    /// @return the codec of the bricks.
+    Codec codec() const;
+
+    /**
+     * @param aBrick the index of a brick.
+     * @return its domain.
+     */
+    Domain brickDomain( std::size_t aBrick ) const;
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return the index of the brick containing it.
+     */
+    std::size_t brickOf( const Point & aPoint ) const;
+
+    /**
+     * @param aDomain a domain.
+     * @return the indices of the bricks intersecting it, in increasing order.
+     */
+    std::vector<std::size_t> bricksIntersecting( const Domain & aDomain ) const;
+
+    /**
+     * Reads (and decompresses) a brick.
+     *
+     * @param aBrick the index of a brick.
+     * @param[out] values its values, in the order of its domain
+     * (brickDomain( aBrick ).size() values).
+     * @throw IOException if the brick cannot be read.
+     */
+    void readBrick( std::size_t aBrick, Value* values ) const;
+
+    /**
+     * Compresses and writes a brick.
+     *
+     * @pre the file is writable.
+     * @param aBrick the index of a brick.
+     * @param values its values, in the order of its domain.
+     * @throw IOException if the brick cannot be written.
+     */
+    void writeBrick( std::size_t aBrick, const Value* values );
+
+    /**
+     * Compresses the values of a brick, without writing them.
+     *
+     * @param aBrick the index of a brick.
+     * @param values its values, in the order of its domain.
+     * @return the encoded brick.
+     */
+    std::vector<unsigned char> encodeBrick( std::size_t aBrick, const Value* values ) const;
+
+    /**
+     * Writes an encoded brick over its previous version if it fits
+     * in its capacity, at the end of the file otherwise, and updates
+     * its index entry.
+     *
+     * @pre the file is writable.
+     * @param aBrick the index of a brick.
+     * @param bytes the encoded brick (see encodeBrick).
+     * @throw IOException if the brick cannot be written.
+     */
+    void storeBrick( std::size_t aBrick, const std::vector<unsigned char> & bytes );
+
+    /**
+     * Reads the values of an image, from the bricks intersecting its
+     * domain. The bricks are decompressed in parallel (with OpenMP),
+     * and also copied in parallel in images whose rows may be written
+     * concurrently (see detail::IsConcurrentlyRowAccessible).
+     *
+     * @tparam TImage a model of concepts::CImage with values of type Value.
+     * @param[in,out] image an image whose domain is included in domain().
+     * @throw IOException if a brick cannot be read.
+     */
+    template <typename TImage>
+    void readInto( TImage & image ) const;
+
+    /**
+     * Writes the values of an image in the bricks intersecting its
+     * domain (the values of the bricks outside of the image domain
+     * are kept). The bricks are compressed in parallel (with OpenMP)
+     * and written in increasing order.
+     *
+     * @pre the file is writable.
+     * @tparam TImage a model of concepts::CConstImage with values of type Value.
+     * @param image an image whose domain is included in domain().
+     * @throw IOException if a brick cannot be written.
+     */
+    template <typename TImage>
+    void writeFrom( const TImage & image );
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    std::string myFilename;       ///< The name of the file.
+    FILE* myFile;                 ///< The file.
+    bool myWritable;              ///< True if bricks may be written.
+    Domain myDomain;              ///< The image domain.
+    Vector myBrickExtent;         ///< The extent of the bricks.
+    Vector myGridExtent;          ///< The number of bricks along each axis.
+    Codec myCodec;                ///< The codec of the bricks.
+    int myLevel;                  ///< The zlib compression level.
+    Word myIndexPosition;         ///< The position of the index in the file.
+    std::vector<Word> myIndex;    ///< (position, size) of each brick.
+    std::vector<Word> myCapacities; ///< The bytes available at the position of each brick.
+    mutable std::mutex myMutex;   ///< Serializes the file accesses.
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Reads the header and the index.
+    void readHeader();
+
+    /// Writes the header and an index of empty bricks.
+    void writeHeader();
+
+    /// @return the brick coordinates of a brick index.
+    Point brickCoords( std::size_t aBrick ) const;
+
+    /// Number of bricks decoded or encoded before being copied.
+    static const std::size_t BATCH_SIZE = 64;
+
+    /**
+     * Copies the values of a decoded brick in an image, on the
+     * intersection of their domains.
+     */
+    template <typename TImage>
+    void scatter( std::size_t aBrick, const std::vector<Value> & values, TImage & image ) const;
+
+    /**
+     * Decodes a brick directly in the storage of an image whose domain
+     * is the domain of the brick.
+     * @return 'true' if the brick was read, 'false' if the image does
+     * not match the brick.
+     */
+    template <typename TImage>
+    bool readDirect( std::size_t aBrick, TImage & image, std::true_type ) const;
+
+    /// Images without a storage in the order of their domain.
+    template <typename TImage>
+    bool readDirect( std::size_t aBrick, TImage & image, std::false_type ) const;
+
+    /**
+     * Copies the values of an image in a decoded brick, on the
+     * intersection of their domains.
+     */
+    template <typename TImage>
+    void gather( std::size_t aBrick, const TImage & image, std::vector<Value> & values ) const;
+
+    /// Copies a row of values (along the first axis) in an image of values of type Value.
+    template <typename TImage>
+    void setRow( TImage & image, const Point & aRow, const Value* values, std::size_t length,
+                 std::true_type ) const;
+
+    /// Sets a row of values (along the first axis) of an image, converting them.
+    template <typename TImage>
+    void setRow( TImage & image, const Point & aRow, const Value* values, std::size_t length,
+                 std::false_type ) const;
+
+    /// Copies a row of values (along the first axis) from an image of values of type Value.
+    template <typename TImage>
+    void getRow( const TImage & image, const Point & aRow, Value* values, std::size_t length,
+                 std::true_type ) const;
+
+    /// Gets a row of values (along the first axis) of an image, converting them.
+    template <typename TImage>
+    void getRow( const TImage & image, const Point & aRow, Value* values, std::size_t length,
+                 std::false_type ) const;
+
+  }; // end of class BrickVolFile
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BrickVolFile'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BrickVolFile' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const BrickVolFile<TDomain, TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/BrickVolFile.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BrickVolFile_h
+
+#undef BrickVolFile_RECURSES
+#endif // else defined(BrickVolFile_RECURSES)
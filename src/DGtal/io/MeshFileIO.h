@@ -0,0 +1,316 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MeshFileIO.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module MeshFileIO.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MeshFileIO_RECURSES)
+#error Recursive header files inclusion detected in MeshFileIO.h
+#else // defined(MeshFileIO_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MeshFileIO_RECURSES
+
+#if !defined MeshFileIO_h
+/** Prevents repeated inclusion of headers. */
+#define MeshFileIO_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace detail
+  {
+    /**
+     * A polygonal mesh stored in flat arrays, as read from a mesh file
+     * by MeshFileIO.
+     */
+    struct MeshFileData
+    {
+      /// The coordinates of the vertices, three per vertex.
+      std::vector<double> coordinates;
+      /// The coordinates of the normal vectors ("vn" lines of OBJ files), three per normal.
+      std::vector<double> normals;
+      /// The vertices of face f are faceVertices[ faceStarts[ f ] ] to
+      /// faceVertices[ faceStarts[ f + 1 ] - 1 ].
+      std::vector<std::size_t> faceStarts;
+      /// The vertex indices of the faces, starting at 0.
+      std::vector<std::size_t> faceVertices;
+      /// The normal indices of the vertices of the faces (OBJ files),
+      /// either empty or aligned with faceVertices.
+      std::vector<std::size_t> faceNormals;
+      /// The RGBA colors of the faces (OFF files) in [0,1], four per
+      /// face, or empty if no face is colored. The red component of
+      /// an uncolored face is negative.
+      std::vector<float> faceColors;
+
+      /// @return the number of vertices.
+      std::size_t nbVertices() const
+      {
+        return coordinates.size() / 3;
+      }
+
+      /// @return the number of faces.
+      std::size_t nbFaces() const
+      {
+        return faceStarts.empty() ? 0 : faceStarts.size() - 1;
+      }
+
+      /// Empties the mesh.
+      void clear();
+    };
+
+    /////////////////////////////////////////////////////////////////////////////
+    // struct MeshFileIO
+    /**
+     * Description of struct 'MeshFileIO' <p>
+     * \brief Aim: reads and writes the OFF, OBJ and binary PLY mesh
+     * formats with few passes over large buffers, used by MeshReader,
+     * MeshWriter, SurfaceMeshReader and SurfaceMeshWriter.
+     *
+     * Files are mapped in memory (see detail::MappedFile). A text is
+     * split into chunks ending at line ends; the lines of each chunk
+     * are counted in parallel, which gives the index of the vertex or
+     * face of each line, then the chunks are parsed in parallel and
+     * write their vertices and faces directly at their place. Numbers
+     * are parsed in place without streams nor locale: decimal numbers
+     * with at most 19 significant digits and a small exponent are
+     * converted exactly with one floating-point operation, the others
+     * with strtod. In binary PLY files, the vertex records have a
+     * fixed size and are decoded in parallel; the face records are
+     * located with one pass over their vertex counts.
+     *
+     * The writers format blocks of BLOCK_SIZE lines (or records) in
+     * parallel in memory buffers, which are written in order with one
+     * call each: the stream is never flushed line by line. Floating
+     * point numbers are written with the precision of the stream.
+     *
+     * With OpenMP, the chunks and blocks are processed in parallel.
+     */
+    struct MeshFileIO
+    {
+      /// Number of lines or records formatted in one block by the writers.
+      static const std::size_t BLOCK_SIZE = 1 << 14;
+      /// Minimal number of bytes of a chunk of text parsed by one thread.
+      static const std::size_t MIN_CHUNK_SIZE = 1 << 16;
+
+      /**
+       * Reads a mesh file in OFF format (or NOFF, the normal vectors
+       * being ignored). The colors of the faces are read.
+       *
+       * @param filename a file name.
+       * @param[out] data the read mesh.
+       * @return 'true' if the file is a valid OFF file.
+       * @throw IOException if the file cannot be opened.
+       */
+      static bool readOFF( const std::string & filename, MeshFileData & data );
+
+      /**
+       * Reads a mesh file in OBJ format: vertices ("v"), normal
+       * vectors ("vn") and faces ("f"), whose indices may be relative.
+       *
+       * @param filename a file name.
+       * @param[out] data the read mesh.
+       * @return 'true' if the file is a valid OBJ file.
+       * @throw IOException if the file cannot be opened.
+       */
+      static bool readOBJ( const std::string & filename, MeshFileData & data );
+
+      /**
+       * Reads a mesh file in binary PLY format (little or big endian):
+       * the x, y, z properties of the "vertex" element and the
+       * vertex_indices list of the "face" element.
+       *
+       * @param filename a file name.
+       * @param[out] data the read mesh.
+       * @return 'true' if the file is a valid binary PLY file.
+       * @throw IOException if the file cannot be opened.
+       */
+      static bool readPLY( const std::string & filename, MeshFileData & data );
+
+      /// Parses an OFF file in [begin,end), see readOFF.
+      static bool parseOFF( const char* begin, const char* end, MeshFileData & data );
+
+      /// Parses an OBJ file in [begin,end), see readOBJ.
+      static bool parseOBJ( const char* begin, const char* end, MeshFileData & data );
+
+      /// Parses a binary PLY file in [begin,end), see readPLY.
+      static bool parsePLY( const char* begin, const char* end, MeshFileData & data );
+
+      /**
+       * Formats items in blocks of BLOCK_SIZE and writes each block on
+       * a stream with one write.
+       *
+       * @tparam TFunctor the type of a functor ( std::string &, std::size_t ) -> void.
+       * @param out the output stream.
+       * @param nb the number of items.
+       * @param format a functor appending the item of given index to
+       * a buffer, called concurrently with OpenMP.
+       * @return 'true' if the stream is still good.
+       */
+      template <typename TFunctor>
+      static bool writeBlocks( std::ostream & out, std::size_t nb, const TFunctor & format );
+
+      /**
+       * Writes a mesh in binary little endian PLY format, with double
+       * coordinates and int vertex indices.
+       *
+       * @tparam TPositionFunctor the type of a functor std::size_t ->
+       * point with three coordinates.
+       * @tparam TFaceFunctor the type of a functor std::size_t ->
+       * range of vertex indices with size() and operator[].
+       * @param out the output stream (opened in binary mode).
+       * @param nbVertices the number of vertices.
+       * @param position the functor giving the position of a vertex.
+       * @param nbFaces the number of faces.
+       * @param face the functor giving the vertices of a face.
+       * @return 'true' if the mesh has been written.
+       */
+      template <typename TPositionFunctor, typename TFaceFunctor>
+      static bool writePLY( std::ostream & out,
+                            std::size_t nbVertices, const TPositionFunctor & position,
+                            std::size_t nbFaces, const TFaceFunctor & face );
+
+      /// Appends an integer in decimal to a buffer.
+      static void appendInteger( std::string & buffer, long long value );
+
+      /// Appends a floating-point number with a given precision
+      /// (printf %g format) to a buffer.
+      static void appendReal( std::string & buffer, double value, int precision );
+
+      /// Appends a number to a buffer, as an integer if its type is integral.
+      template <typename TNumber>
+      static void appendNumber( std::string & buffer, TNumber value, int precision );
+
+      /**
+       * Parses a decimal number after blanks.
+       * @param p the first character.
+       * @param end the end of the text.
+       * @param[out] value the number.
+       * @return the character after the number, or nullptr if there is no number.
+       */
+      static const char* parseReal( const char* p, const char* end, double & value );
+
+      /**
+       * Parses a decimal integer after blanks.
+       * @param p the first character.
+       * @param end the end of the text.
+       * @param[out] value the integer.
+       * @return the character after the integer, or nullptr if there is no integer.
+       */
+      static const char* parseInteger( const char* p, const char* end, long long & value );
+
+      /**
+       * Appends the bytes of a value to a buffer.
+       * @param buffer a buffer.
+       * @param value a value of arithmetic type.
+       * @param swap when 'true', the bytes are appended in reverse order.
+       */
+      template <typename TValue>
+      static void appendBinary( std::string & buffer, TValue value, bool swap );
+
+      /// @return the number of threads used with OpenMP, 1 without OpenMP.
+      static std::size_t nbThreads();
+
+      /// @return the number of chunks a text of given size is split into.
+      static std::size_t nbChunks( std::size_t size );
+
+      /// @return 'true' if the host is little endian.
+      static bool isHostLittleEndian();
+
+    private:
+      /// The value types of PLY properties.
+      enum PLYType { PLY_INT8, PLY_UINT8, PLY_INT16, PLY_UINT16,
+                     PLY_INT32, PLY_UINT32, PLY_FLOAT32, PLY_FLOAT64, PLY_UNKNOWN };
+
+      /// A property of a PLY element.
+      struct PLYProperty
+      {
+        std::string name;  ///< The property name.
+        PLYType type;      ///< The value type (of the list items for a list).
+        PLYType countType; ///< The type of the list size, PLY_UNKNOWN if not a list.
+      };
+
+      /// An element of a PLY file.
+      struct PLYElement
+      {
+        std::string name;                     ///< The element name.
+        std::size_t count;                    ///< The number of records.
+        std::vector<PLYProperty> properties;  ///< The properties of a record.
+      };
+
+      /// @return the type of a PLY type name.
+      static PLYType plyType( const std::string & name );
+
+      /// @return the size in bytes of a PLY type.
+      static std::size_t plySize( PLYType type );
+
+      /// @return the PLY value of given type at p, with bytes swapped if asked.
+      static double plyValue( const char* p, PLYType type, bool swap );
+
+      /// @return the first character of the next line.
+      static const char* nextLine( const char* p, const char* end );
+
+      /// @return the first character which is not a space, a tab or a carriage return.
+      static const char* skipBlanks( const char* p, const char* end );
+
+      /**
+       * Splits a text in chunks ending at line ends.
+       * @param begin the beginning of the text.
+       * @param end the end of the text.
+       * @return the nbChunks + 1 chunk boundaries.
+       */
+      static std::vector<const char*> splitLines( const char* begin, const char* end );
+
+      /**
+       * Calls a functor on the lines of a text which are neither empty
+       * nor comments, until it returns false.
+       * @tparam TFunctor the type of a functor ( const char*, const char* ) -> bool.
+       */
+      template <typename TFunctor>
+      static void forEachLine( const char* begin, const char* end, const TFunctor & f );
+    };
+
+  } // namespace detail
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/MeshFileIO.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MeshFileIO_h
+
+#undef MeshFileIO_RECURSES
+#endif // else defined(MeshFileIO_RECURSES)
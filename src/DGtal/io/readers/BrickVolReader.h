@@ -0,0 +1,120 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BrickVolReader.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module BrickVolReader.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BrickVolReader_RECURSES)
+#error Recursive header files inclusion detected in BrickVolReader.h
+#else // defined(BrickVolReader_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BrickVolReader_RECURSES
+
+#if !defined BrickVolReader_h
+/** Prevents repeated inclusion of headers. */
+#define BrickVolReader_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/io/BrickVolFile.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BrickVolReader
+  /**
+   * Description of template struct 'BrickVolReader' <p>
+   * \brief Aim: implements methods to read a "brick vol" file (see
+   * BrickVolFile), either entirely or on a region of interest.
+   *
+   * Only the bricks intersecting the region are read, and they are
+   * decompressed in parallel when OpenMP is enabled.
+   *
+   * Example usage:
+   * @code
+   * typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+   * Image image = BrickVolReader<Image>::importBrickVol( "data.bvol" );
+   * Image roi = BrickVolReader<Image>::importBrickVol( "data.bvol",
+   *                     Z3i::Domain( Z3i::Point( 0, 0, 10 ), Z3i::Point( 511, 511, 10 ) ) );
+   * @endcode
+   *
+   * @tparam TImageContainer the image container to use, whose values
+   * have the type of the values of the file.
+   *
+   * @see BrickVolWriter, testBrickVol.cpp
+   */
+  template <typename TImageContainer>
+  struct BrickVolReader
+  {
+    // ----------------------- Standard services ------------------------------
+    typedef TImageContainer ImageContainer;
+    typedef typename TImageContainer::Domain Domain;
+    typedef typename TImageContainer::Value Value;
+    typedef BrickVolFile<Domain, Value> File;
+
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImageContainer> ));
+
+    /**
+     * Imports a whole brick vol file.
+     *
+     * @param filename the file name to import.
+     * @return an instance of the ImageContainer.
+     * @throw IOException if the file cannot be read.
+     */
+    static ImageContainer importBrickVol( const std::string & filename );
+
+    /**
+     * Imports a region of interest of a brick vol file.
+     *
+     * @param filename the file name to import.
+     * @param aROI a domain, intersecting the domain of the file.
+     * @return an instance of the ImageContainer, whose domain is the
+     * intersection of aROI and of the domain of the file.
+     * @throw IOException if the file cannot be read or if aROI is
+     * outside of its domain.
+     */
+    static ImageContainer importBrickVol( const std::string & filename,
+                                          const Domain & aROI );
+  };
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/BrickVolReader.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BrickVolReader_h
+
+#undef BrickVolReader_RECURSES
+#endif // else defined(BrickVolReader_RECURSES)
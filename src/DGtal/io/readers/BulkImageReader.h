@@ -0,0 +1,206 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BulkImageReader.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module BulkImageReader.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BulkImageReader_RECURSES)
+#error Recursive header files inclusion detected in BulkImageReader.h
+#else // defined(BulkImageReader_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BulkImageReader_RECURSES
+
+#if !defined BulkImageReader_h
+/** Prevents repeated inclusion of headers. */
+#define BulkImageReader_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <cstdio>
+#include <cstddef>
+#include <type_traits>
+#include <map>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/BasicFunctors.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  template <typename TDomain, typename TValue>
+  class ImageContainerBySTLVector;
+
+  namespace detail
+  {
+    /**
+     * Tells if the values of an image can be written directly in its
+     * storage, in the order of its domain, instead of through
+     * setValue: this is the case for an ImageContainerBySTLVector
+     * when the import functor is a plain cast, except for bool values
+     * (a std::vector<bool> has no data()).
+     *
+     * @tparam TImage an image type.
+     * @tparam TFunctor the functor used in the import.
+     */
+    template <typename TImage, typename TFunctor>
+    struct IsBulkImportable : std::false_type {};
+
+    template <typename TDomain, typename TValue>
+    struct IsBulkImportable< ImageContainerBySTLVector<TDomain, TValue>,
+                             functors::Cast<TValue> >
+      : std::integral_constant< bool, ! std::is_same<TValue, bool>::value > {};
+
+    template <typename TDomain, typename TValue>
+    struct IsBulkImportable< ImageContainerBySTLVector<TDomain, TValue>,
+                             functors::Identity >
+      : std::integral_constant< bool, ! std::is_same<TValue, bool>::value > {};
+
+    /////////////////////////////////////////////////////////////////////////////
+    // struct BulkImageReader
+    /**
+     * Description of struct 'BulkImageReader' <p>
+     * \brief Aim: reads the payload of an image file (raw words,
+     * possibly zlib compressed) with large reads, used by VolReader,
+     * LongvolReader and RawReader.
+     *
+     * The payload is read with one fread, or inflated by chunks of
+     * CHUNK_SIZE bytes while reading the file. When the image is an
+     * ImageContainerBySTLVector imported with a plain cast (see
+     * IsBulkImportable), the words are read (or inflated) directly in
+     * the storage of the image if they have the type of its values
+     * and the byte order of the host, and are converted in one pass
+     * otherwise. Other images are filled through setValue.
+     *
+     * It also reads the header of vol and longvol files, for these
+     * readers and for ImageContainerByMappedFile.
+     */
+    struct BulkImageReader
+    {
+      /// Size of the chunks of compressed data read from the file.
+      static const std::size_t CHUNK_SIZE = 1 << 20;
+
+      /**
+       * Reads the words of an image, in the order of its domain.
+       *
+       * @tparam TWord the type of words in the file.
+       * @tparam TImage the image type.
+       * @tparam TFunctor the type of the functor converting words to values.
+       * @param fin a file, at the beginning of the payload.
+       * @param[in,out] image an image whose domain is the one of the file.
+       * @param aFunctor the functor converting words to values.
+       * @param compressed true if the payload is zlib compressed.
+       * @param littleEndian true if the words are stored in little
+       * endian order, false if they are in the host order.
+       * @return 'true' if the payload had enough words, 'false' otherwise.
+       */
+      template <typename TWord, typename TImage, typename TFunctor>
+      static bool importWords( FILE* fin, TImage & image, const TFunctor & aFunctor,
+                               bool compressed, bool littleEndian );
+
+      /**
+       * Reads bytes from a file with as few fread as possible.
+       *
+       * @param fin a file.
+       * @param dst the output buffer.
+       * @param nbBytes the number of bytes to read.
+       * @return the number of read bytes.
+       */
+      static std::size_t readBytes( FILE* fin, unsigned char* dst, std::size_t nbBytes );
+
+      /**
+       * Inflates zlib compressed data read from a file by chunks.
+       *
+       * @param fin a file, at the beginning of the compressed data.
+       * @param dst the output buffer.
+       * @param nbBytes the number of bytes to inflate.
+       * @return the number of inflated bytes.
+       */
+      static std::size_t inflateBytes( FILE* fin, unsigned char* dst, std::size_t nbBytes );
+
+      /// @return 'true' if the host is little endian.
+      static bool isHostLittleEndian();
+
+      /**
+       * Reads the header of a vol or longvol file: "Field: value"
+       * lines, up to a line with a single dot. The endian fields are
+       * only required when there is no Version field.
+       *
+       * @param fin a file, at its beginning. On return, it is at the
+       * beginning of the payload.
+       * @param aReaderName the name used in error messages.
+       * @param longvol true for a longvol file, false for a vol file.
+       * @param[out] aLowerBound the lower bound of the domain.
+       * @param[out] anUpperBound the upper bound of the domain.
+       * @return the version of the file (2 or 3).
+       * @throw IOException if the header is invalid.
+       */
+      static int readVolHeader( FILE* fin, const char* aReaderName, bool longvol,
+                                int aLowerBound[ 3 ], int anUpperBound[ 3 ] );
+
+    private:
+      /// Reads or inflates bytes.
+      static std::size_t getBytes( FILE* fin, unsigned char* dst, std::size_t nbBytes,
+                                   bool compressed );
+
+      /// Read in the storage of the image, unless the bytes must be swapped.
+      template <typename TWord, typename TImage, typename TFunctor>
+      static bool importInPlace( FILE* fin, TImage & image, const TFunctor & aFunctor,
+                                 bool compressed, bool littleEndian, std::true_type );
+
+      /// Read in a buffer, then conversion.
+      template <typename TWord, typename TImage, typename TFunctor>
+      static bool importInPlace( FILE* fin, TImage & image, const TFunctor & aFunctor,
+                                 bool compressed, bool littleEndian, std::false_type );
+
+      /// Conversion of the words in the storage of the image.
+      template <typename TWord, typename TImage, typename TFunctor>
+      static void fill( TImage & image, const unsigned char* bytes, const TFunctor & aFunctor,
+                        bool swap, std::true_type );
+
+      /// Conversion of the words with setValue.
+      template <typename TWord, typename TImage, typename TFunctor>
+      static void fill( TImage & image, const unsigned char* bytes, const TFunctor & aFunctor,
+                        bool swap, std::false_type );
+
+      /// @return the i-th word of a buffer, with its bytes reversed if \a swap.
+      template <typename TWord>
+      static TWord word( const unsigned char* bytes, std::size_t i, bool swap );
+    };
+
+  } // namespace detail
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/BulkImageReader.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BulkImageReader_h
+
+#undef BulkImageReader_RECURSES
+#endif // else defined(BulkImageReader_RECURSES)
@@ -44,6 +44,7 @@
 #include <DGtal/kernel/SpaceND.h>
 #include "DGtal/base/Common.h"
 #include "DGtal/shapes/Mesh.h"
+#include "DGtal/io/MeshFileIO.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -57,8 +58,11 @@ namespace DGtal
 /**
  * Description of class 'MeshReader' <p> 
  * \brief Aim: Defined to import
- * OFF and OFS surface mesh. It allows to import a Mesh object and takes
+ * OFF, OFS and binary PLY surface mesh. It allows to import a Mesh object and takes
  * into accouts the optional color faces.
+ *
+ * OFF and PLY files are mapped in memory and parsed in parallel by
+ * chunks (see detail::MeshFileIO).
  * 
  * The importation can be done automatically according the input file
  * extension with the operator << 
@@ -126,6 +130,32 @@ public:
   
   static  bool  importOFSFile(const std::string & filename, 
 			      DGtal::Mesh<TPoint> & aMesh, bool invertVertexOrder=false, double scale=1.0);
+
+
+ /** 
+  * Main method to import binary PLY meshes file (Stanford Polygon
+  * File Format, little or big endian).
+  * 
+  * @param filename the file name to import.
+  * @param aMesh (return) the mesh object to be imported.
+  * @param invertVertexOrder used to invert (default value=false) the order of imported points (important for normal orientation). 
+  * @return true if the mesh has been imported.
+  */
+  
+  static  bool  importPLYFile(const std::string & filename, 
+			      DGtal::Mesh<TPoint> & aMesh, bool invertVertexOrder=false);
+
+private:
+
+ /** 
+  * Adds the vertices and faces read from a file to a mesh.
+  * 
+  * @param data the mesh read from a file.
+  * @param aMesh (return) the mesh object to be imported.
+  * @param invertVertexOrder used to invert the order of imported points.
+  */
+  static void fillMesh(const detail::MeshFileData & data,
+                       DGtal::Mesh<TPoint> & aMesh, bool invertVertexOrder);
   
   
   
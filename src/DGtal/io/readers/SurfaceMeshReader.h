@@ -46,6 +46,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/shapes/SurfaceMesh.h"
+#include "DGtal/io/MeshFileIO.h"
 
 namespace DGtal
 {
@@ -54,7 +55,11 @@ namespace DGtal
   // template class SurfaceMeshReader
   /**
      Description of template class 'SurfaceMeshReader' <p> \brief Aim:
-     An helper class for reading mesh files (Wavefront OBJ at this point) and creating a SurfaceMesh.
+     An helper class for reading mesh files (Wavefront OBJ, OFF and
+     binary PLY) and creating a SurfaceMesh.
+
+     Files are mapped in memory and parsed in parallel by chunks (see
+     detail::MeshFileIO); a stream is read at once before being parsed.
 
      @tparam TRealPoint an arbitrary model of RealPoint.
      @tparam TRealVector an arbitrary model of RealVector.
@@ -97,6 +102,55 @@ namespace DGtal
     /// created mesh is ok.
     static
     bool readOBJ( std::istream & input, SurfaceMesh & smesh );
+
+    /// Reads a file in OBJ file format and outputs the corresponding
+    /// surface mesh.
+    ///
+    /// @param[in] filename the name of the OBJ file.
+    /// @param[out] smesh the output surface mesh.
+    ///
+    /// @return 'true' if both reading the file was ok and the
+    /// created mesh is ok.
+    /// @throw IOException if the file cannot be opened.
+    static
+    bool readOBJ( const std::string & filename, SurfaceMesh & smesh );
+
+    /// Reads a file in OFF file format (face colors are ignored) and
+    /// outputs the corresponding surface mesh.
+    ///
+    /// @param[in] filename the name of the OFF file.
+    /// @param[out] smesh the output surface mesh.
+    ///
+    /// @return 'true' if both reading the file was ok and the
+    /// created mesh is ok.
+    /// @throw IOException if the file cannot be opened.
+    static
+    bool readOFF( const std::string & filename, SurfaceMesh & smesh );
+
+    /// Reads a file in binary PLY file format and outputs the
+    /// corresponding surface mesh.
+    ///
+    /// @param[in] filename the name of the PLY file.
+    /// @param[out] smesh the output surface mesh.
+    ///
+    /// @return 'true' if both reading the file was ok and the
+    /// created mesh is ok.
+    /// @throw IOException if the file cannot be opened.
+    static
+    bool readPLY( const std::string & filename, SurfaceMesh & smesh );
+
+  private:
+    /// Initializes a surface mesh from the flat arrays read from a
+    /// file, skipping the faces with repeated vertices.
+    ///
+    /// @param[in] data the mesh read from a file.
+    /// @param[out] smesh the output surface mesh.
+    /// @param[in] method the name of the calling method, for messages.
+    ///
+    /// @return 'true' if the created mesh is ok.
+    static
+    bool initMesh( const detail::MeshFileData & data, SurfaceMesh & smesh,
+                   const std::string & method );
   };
   
 } // namespace DGtal
@@ -117,56 +117,7 @@ namespace DGtal
   private:
 
     typedef unsigned char voxel;
-    /**
-     * This class help us to associate a field type and his value.
-     * An object is a pair (type, value). You can copy and assign
-     * such objects.
-     */
-    /* In recent C++, we should use a std::map, but we prefer (badly) code it
-       by hand for compatibility with old compilers.
-       At this time, there is a limit of 30 fields in header :-} */
-    struct HeaderField {
-      //! Constructor. The string are copied.
-      HeaderField( const char *t, const char *v ) :
-        type( strdup(t) ), value( strdup(v) ) {}
-      ~HeaderField() {
-        free( type );
-        free( value );
-      }
-      //! Copy constructor
-      HeaderField( const HeaderField &h ) :
-        type( strdup(h.type) ), value( strdup(h.value) ) {};
-      //! Default constructor
-      HeaderField() : type(NULL), value(NULL) {};
-      //! Assignement operator
-      const HeaderField &operator = (const HeaderField &h) {
-        free( type );
-        free( value );
-        if (h.type != NULL) {
-          type = strdup( h.type );
-          value = strdup( h.value );
-        }
-        return *this;
-      }
-      //! Type of field (e.g. Voxel-Size)
-      char *type;
-      //! Value of field (e.g. 2)
-      char *value;
-    };
-
-
-    //! Returns NULL if this field is not found
-    static const char *getHeaderValue( const char *type, const HeaderField * header );
-
-    //! Returns non-zero if failure
-    static     int getHeaderValueAsInt( const char *type, int *dest , const HeaderField * header); 
-    
-    //! Internal method which returns the index of a field or -1 if not found.
-    static int getHeaderField( const char *type, const HeaderField * header ) ;
-    
-    //! Global list of required fields in a .vol file
-    static const char *requiredHeaders[];
-   
+
   }; // end of class VolReader
 
 
@@ -0,0 +1,103 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BrickVolWriter.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module BrickVolWriter.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BrickVolWriter_RECURSES)
+#error Recursive header files inclusion detected in BrickVolWriter.h
+#else // defined(BrickVolWriter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BrickVolWriter_RECURSES
+
+#if !defined BrickVolWriter_h
+/** Prevents repeated inclusion of headers. */
+#define BrickVolWriter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/images/CConstImage.h"
+#include "DGtal/io/BrickVolFile.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BrickVolWriter
+  /**
+   * Description of template struct 'BrickVolWriter' <p>
+   * \brief Aim: Export an Image in the "brick vol" format (see
+   * BrickVolFile): its domain is cut into bricks that are compressed
+   * independently, in parallel when OpenMP is enabled.
+   *
+   * @tparam TImage the Image type.
+   *
+   * @see BrickVolReader, testBrickVol.cpp
+   */
+  template <typename TImage>
+  struct BrickVolWriter
+  {
+    // ----------------------- Standard services ------------------------------
+    typedef TImage Image;
+    typedef typename TImage::Domain Domain;
+    typedef typename TImage::Value Value;
+    typedef typename Domain::Vector Vector;
+    typedef BrickVolFile<Domain, Value> File;
+    typedef typename File::Codec Codec;
+
+    BOOST_CONCEPT_ASSERT(( concepts::CConstImage<TImage> ));
+
+    /**
+     * Export an Image with the brick vol format.
+     *
+     * @param filename name of the output file.
+     * @param aImage the image to export.
+     * @param aBrickExtent the extent of the bricks.
+     * @param aCodec the compression of the bricks (File::ZLIB or File::RAW).
+     * @param aLevel the zlib compression level (from 1 to 9).
+     * @return true if no errors occur.
+     */
+    static bool exportBrickVol( const std::string & filename, const Image & aImage,
+                                const Vector & aBrickExtent = Vector::diagonal( 64 ),
+                                Codec aCodec = File::ZLIB, int aLevel = 6 );
+  };
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/writers/BrickVolWriter.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BrickVolWriter_h
+
+#undef BrickVolWriter_RECURSES
+#endif // else defined(BrickVolWriter_RECURSES)
@@ -45,6 +45,7 @@
 #include <boost/static_assert.hpp>
 #include "DGtal/base/Common.h"
 #include "DGtal/shapes/Mesh.h"
+#include "DGtal/io/MeshFileIO.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -54,7 +55,12 @@ namespace DGtal
   // template class MeshWriter
   /**
    * Description of template struct 'MeshWriter' <p>
-   * \brief Aim: Export a Mesh (Mesh object) in different format as OFF and OBJ).
+   * \brief Aim: Export a Mesh (Mesh object) in different format as OFF, OBJ and binary PLY).
+   * 
+   * Lines are formatted by blocks, in parallel with OpenMP, and each
+   * block is written at once (see detail::MeshFileIO): the stream is
+   * not flushed at each line. Coordinates are written with the
+   * precision of the stream.
    * 
    * The exportation can be done automatically according the input file
    * extension with the ">>" operator  
@@ -119,6 +125,29 @@ namespace DGtal
     static bool export2OBJ_colors(std::ostream &out, std::ostream &outMTL,
                                   const std::string nameMTLFile,
                                   const  Mesh<TPoint>  &aMesh);
+
+    /** 
+     * Export a Mesh towards a binary PLY format (face colors are not
+     * exported).
+     * 
+     * @param out the output stream of the exported PLY object, opened in binary mode.
+     * @param aMesh the Mesh object to be exported.
+     * @return true if no errors occur.
+     */
+    
+    static bool export2PLY(std::ostream &out, const  Mesh<TPoint>  &aMesh);
+
+  private:
+
+    /// Writes the "v" lines of a Mesh in OBJ format.
+    static void exportOBJVertices(std::ostream &out, const  Mesh<TPoint>  &aMesh);
+
+    /// Appends the coordinates of a point, separated by spaces, to a buffer.
+    static void appendPoint(std::string & buffer, const TPoint & aPoint, int precision);
+
+    /// Appends the "f" line of a face in OBJ format to a buffer.
+    static void appendOBJFace(std::string & buffer,
+                              const typename Mesh<TPoint>::MeshFace & aFace);
     
     
   };
@@ -130,7 +159,7 @@ namespace DGtal
   /**
    *  'operator>>' for exporting objects of class 'Mesh'.
    *  This operator automatically selects the good method according to
-   *  the filename extension (off, obj).
+   *  the filename extension (off, obj, ply).
    *  
    * @param aMesh the mesh to be exported.
    * @param aFilename the filename of the file to be exported. 
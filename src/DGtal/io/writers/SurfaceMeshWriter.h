@@ -47,6 +47,7 @@
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/shapes/SurfaceMesh.h"
 #include "DGtal/io/Color.h"
+#include "DGtal/io/MeshFileIO.h"
 
 namespace DGtal
 {
@@ -55,7 +56,12 @@ namespace DGtal
   // template class SurfaceMeshWriter
   /**
      Description of template class 'SurfaceMeshWriter' <p> \brief Aim:
-     An helper class for writing mesh file formats (Waverfront OBJ at this point) and creating a SurfaceMesh.
+     An helper class for writing mesh file formats (Waverfront OBJ and
+     binary PLY) and creating a SurfaceMesh.
+
+     Vertex and face lines are formatted by blocks, in parallel with
+     OpenMP, and each block is written at once (see
+     detail::MeshFileIO), with the precision of the output stream.
 
      @tparam TRealPoint an arbitrary model of RealPoint.
      @tparam TRealVector an arbitrary model of RealVector.
@@ -87,6 +93,15 @@ namespace DGtal
     static
     bool writeOBJ( std::ostream & output, const SurfaceMesh & smesh );
 
+    /// Writes a surface mesh in an output stream in binary little
+    /// endian PLY file format.
+    /// @param[in,out] output the output stream where the PLY file is
+    /// written, opened in binary mode.
+    /// @param[in] smesh the surface mesh.
+    /// @return 'true' if writing in the output stream was ok.
+    static
+    bool writePLY( std::ostream & output, const SurfaceMesh & smesh );
+
     /// Writes a surface mesh in the given OBJ file (and an associated
     /// MTL file) and associate color information.
     ///
@@ -195,6 +210,22 @@ namespace DGtal
                            const Color&           ambient_color = Color::Black,
                            const Color&           diffuse_color = Color::Black,
                            const Color&           specular_color= Color::Black );
+
+  private:
+    /// Writes the "v" lines, and the "vn" lines if any, of a surface mesh in OBJ format.
+    /// @param[in,out] output the output stream.
+    /// @param[in] smesh the surface mesh.
+    static
+    void writeOBJVertices( std::ostream & output, const SurfaceMesh & smesh );
+
+    /// Writes a range of vectors as OBJ lines.
+    /// @tparam TVectors a vector of RealPoint or of RealVector.
+    /// @param[in,out] output the output stream.
+    /// @param[in] keyword the keyword of the lines ("v" or "vn").
+    /// @param[in] vectors the vectors.
+    template <typename TVectors>
+    static
+    void writeOBJVectors( std::ostream & output, const char* keyword, const TVectors & vectors );
     
   };
 
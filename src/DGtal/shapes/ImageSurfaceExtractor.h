@@ -0,0 +1,299 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageSurfaceExtractor.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module ImageSurfaceExtractor.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageSurfaceExtractor_RECURSES)
+#error Recursive header files inclusion detected in ImageSurfaceExtractor.h
+#else // defined(ImageSurfaceExtractor_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageSurfaceExtractor_RECURSES
+
+#if !defined ImageSurfaceExtractor_h
+/** Prevents repeated inclusion of headers. */
+#define ImageSurfaceExtractor_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <array>
+#include <utility>
+#include <cstdint>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/images/CConstImage.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageSurfaceExtractor
+  /**
+   * Description of template class 'ImageSurfaceExtractor' <p>
+   * \brief Aim: extracts directly from a 3D image the mesh of the
+   * boundary of the shape made of the voxels whose value is above a
+   * threshold, without building a digital surface.
+   *
+   * The boundary surfels are the faces between two voxels of the
+   * image domain, one inside the shape and the other outside, as in
+   * Surfaces::sMakeBoundary. Two meshes are extracted:
+   *
+   * - the dual mesh (extractDual), whose vertices are the surfels and
+   *   whose faces are the umbrellas of surfels around the pointels
+   *   interior to the domain, i.e. the closed faces of the
+   *   DigitalSurface of the boundary surfels with the same surfel
+   *   adjacency. This is a marching-cubes on the cubes of 8 voxels
+   *   around each pointel: the umbrellas of the 256 configurations
+   *   are computed once, the ambiguous faces of the cubes being
+   *   resolved by the surfel adjacency;
+   *
+   * - the primal mesh (extractPrimal), whose vertices are the
+   *   pointels of the surfels and whose faces are the surfels.
+   *
+   * The volume is processed by slabs of constant z, in parallel with
+   * OpenMP. The shape is first stored as a bit mask. The surfels are
+   * then counted and numbered row by row: their table is a compact
+   * array of keys (3x+k for the surfel above voxel (x,y,z) along axis
+   * k) with the offset of each row (y,z), so that a surfel is found
+   * by a binary search in its row. The pointels of the primal mesh
+   * are numbered the same way. Vertices and faces are numbered in
+   * the order of the rows, whatever the number of threads.
+   *
+   * @code
+   * ImageSurfaceExtractor< BinaryImage > extractor( image, false );
+   * ImageSurfaceExtractor< BinaryImage >::RealPoints positions;
+   * ImageSurfaceExtractor< BinaryImage >::Faces      faces;
+   * extractor.extractDual( positions, faces );
+   * @endcode
+   *
+   * @tparam TImage a model of concepts::CConstImage on a 3D
+   * HyperRectDomain, whose values are comparable with operator>.
+   */
+  template <typename TImage>
+  class ImageSurfaceExtractor
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CConstImage<TImage> ));
+
+    // ----------------------- Types ------------------------------
+  public:
+    typedef ImageSurfaceExtractor<TImage> Self;
+    typedef TImage Image;
+    typedef typename Image::Domain Domain;
+    typedef typename Image::Point Point;
+    typedef typename Image::Value Value;
+    typedef typename Point::Coordinate Coordinate;
+    typedef typename Point::Dimension Dimension;
+    BOOST_STATIC_ASSERT(( Point::dimension == 3 ));
+
+    typedef std::size_t Index;
+    typedef std::size_t Size;
+    typedef PointVector<3, double> RealPoint;
+    typedef std::vector<RealPoint> RealPoints;
+    /// A face, as the range of its vertex indices.
+    typedef std::vector<Index> Face;
+    typedef std::vector<Face> Faces;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Computes the bit mask of the shape and the table of
+     * its boundary surfels.
+     *
+     * @param anImage the image (aliased).
+     * @param aThreshold the voxels of value greater than aThreshold
+     * are inside the shape (e.g. 'false' for a binary image).
+     * @param int2ext the surfel adjacency, as in SurfelAdjacency
+     * (used by extractDual only).
+     */
+    ImageSurfaceExtractor( ConstAlias<Image> anImage, const Value & aThreshold,
+                           bool int2ext = false );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /// @return the image.
+    const Image & image() const;
+
+    /// @return the number of boundary surfels.
+    Size nbSurfels() const;
+
+    /**
+     * @param aPoint a point of the image domain.
+     * @return 'true' if aPoint is inside the shape.
+     */
+    bool isInside( const Point & aPoint ) const;
+
+    /**
+     * @param i the index of a boundary surfel, i.e. of a vertex of the
+     * dual mesh or of a face of the primal mesh.
+     * @return the voxel below the surfel and the axis k of its normal
+     * (the surfel lies between this voxel and the next one along k).
+     */
+    std::pair<Point, Dimension> surfel( Index i ) const;
+
+    /**
+     * Extracts the dual mesh of the boundary.
+     *
+     * @param[out] positions the positions of the vertices, one per
+     * boundary surfel.
+     * @param[out] faces the umbrellas around the pointels interior to
+     * the domain.
+     * @param linear when 'false', a vertex is the centroid of its
+     * surfel (as with CanonicCellEmbedder); when 'true', it is placed
+     * by linear interpolation of the values of the two voxels at
+     * value threshold+0.5 (as with ImageLinearCellEmbedder).
+     */
+    void extractDual( RealPoints & positions, Faces & faces,
+                      bool linear = false ) const;
+
+    /**
+     * Extracts the primal mesh of the boundary.
+     *
+     * @param[out] positions the positions of the vertices, i.e. of the
+     * pointels of the boundary surfels (as with CanonicCellEmbedder).
+     * @param[out] faces the faces, one per boundary surfel (face i is
+     * surfel i), oriented counterclockwise around the outward normal.
+     */
+    void extractPrimal( RealPoints & positions, Faces & faces ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected types ------------------------------
+  protected:
+    /// The umbrellas of a configuration of a cube of 8 voxels, each
+    /// one being a cycle of cube edges. The corner (a0,a1,a2) of the
+    /// cube has index a0+2a1+4a2, the edge between the corners a and
+    /// a+e_k has index 4k + a_(k+1) + 2a_(k+2).
+    typedef std::vector< std::vector< unsigned char > > Umbrellas;
+    /// The umbrellas of the 256 configurations of a cube, indexed by
+    /// the bits of the corners inside the shape.
+    typedef std::array< Umbrellas, 256 > UmbrellaTable;
+
+    // ------------------------- Protected services ---------------------------
+  protected:
+
+    /// @return 'true' if voxel (x,y,z), relative to the lower bound
+    /// of the domain, is inside the shape.
+    bool inside( Coordinate x, Coordinate y, Coordinate z ) const
+    {
+      const Size bit = Size( x );
+      return ( myMask[ ( Size( z ) * mySize[ 1 ] + Size( y ) ) * myRowWords + ( bit >> 6 ) ]
+               >> ( bit & 63 ) ) & 1;
+    }
+
+    /// @return the index of the surfel above voxel (x,y,z) along axis
+    /// k, which must be a boundary surfel.
+    Index surfelIndex( Coordinate x, Coordinate y, Coordinate z, Dimension k ) const;
+
+    /// @return the position of the vertex of the boundary surfel
+    /// above aVoxel along axis k (see extractDual).
+    RealPoint surfelPosition( const Point & aVoxel, Dimension k, bool linear ) const;
+
+    /// Fills the bit mask of the shape, by slabs in parallel.
+    void computeMask();
+
+    /// Counts then numbers the boundary surfels, by slabs in parallel.
+    void computeSurfels();
+
+    /// @return the number of boundary surfels with pointel (x,y,z)
+    /// as a vertex (at most 12), coordinates being relative to the
+    /// lower bound of the domain.
+    Size nbSurfelsAroundPointel( Coordinate x, Coordinate y, Coordinate z ) const;
+
+    /// @return the bits of the corners inside the shape of the cube
+    /// of voxels (x..x+1, y..y+1, z..z+1).
+    unsigned int cubeConfiguration( Coordinate x, Coordinate y, Coordinate z ) const;
+
+    /// @return the umbrella table for the given surfel adjacency,
+    /// computed at the first call.
+    static const UmbrellaTable & umbrellaTable( bool int2ext );
+
+    /// @return the umbrellas of all the configurations of a cube for
+    /// the given surfel adjacency.
+    static UmbrellaTable computeUmbrellaTable( bool int2ext );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The image.
+    const Image * myImage;
+    /// The voxels of value greater than myThreshold are inside the shape.
+    Value myThreshold;
+    /// The surfel adjacency.
+    bool myInt2Ext;
+    /// The lower bound of the domain.
+    Point myLower;
+    /// The number of voxels of the domain along each axis.
+    std::array< Size, 3 > mySize;
+    /// The number of 64-bit words of a row of the mask.
+    Size myRowWords;
+    /// The shape, one bit per voxel, row by row.
+    std::vector< std::uint64_t > myMask;
+    /// The surfels of row (y,z) are mySurfelKeys[ i ] for
+    /// mySurfelStarts[ y + Y*z ] <= i < mySurfelStarts[ y + Y*z + 1 ].
+    std::vector< Index > mySurfelStarts;
+    /// The keys 3x+k of the surfels, increasing in each row.
+    std::vector< std::uint32_t > mySurfelKeys;
+
+  }; // end of class ImageSurfaceExtractor
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageSurfaceExtractor'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageSurfaceExtractor' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImage>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageSurfaceExtractor<TImage> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/shapes/ImageSurfaceExtractor.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageSurfaceExtractor_h
+
+#undef ImageSurfaceExtractor_RECURSES
+#endif // else defined(ImageSurfaceExtractor_RECURSES)
@@ -32,6 +32,8 @@
 
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
+#include <vector>
+#include <utility>
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/shapes/Mesh.h"
@@ -71,6 +73,16 @@ namespace DGtal
    @image html 6-sep.png "Template for 6-separating digitization"
    @image html 26-sep.png "Template for 26-separating digitization"
 
+   The faces of a mesh are voxelized in parallel with OpenMP: the
+   faces are split into ranges, each range collects its voxels in its
+   own buffer (only the voxels of the domain, the bounding boxes of the
+   triangles being clipped to it), and the sorted buffers are merged
+   at the end, so that threads never synchronize on the output. The
+   voxels can be written directly in an image (see voxelizeInImage),
+   and the interior of a closed mesh can be filled by counting the
+   crossings of the mesh along the lines parallel to the z-axis (see
+   interiorVoxels).
+
 
    @tparam TDigitalSet a DigitalSet (model of concepts::CDigitalSet)
    @tparam Separation strategy of the voxelization (6 or 26)
@@ -102,6 +114,7 @@ namespace DGtal
     using PointZ3  = typename Space::Point;
     using OrientationFunctor = InHalfPlaneBySimple3x3Matrix<PointR2, double>;
     using IntersectionTarget = typename IntersectionTargetTrait<Space, Separation, 1>::Type;
+    using Voxels   = std::vector< PointZ3 >;
     /*********************************************/
 
   public:
@@ -151,7 +164,68 @@ namespace DGtal
                   const MeshPoint &a, const MeshPoint &b, const MeshPoint &c,
                   const double scaleFactor = 1.0);
 
+    /**
+     * Computes the voxels of the digitization of a mesh that lie in a
+     * domain. The faces are voxelized in parallel with OpenMP (see the
+     * class description), non-triangular faces being triangulated as
+     * in voxelize.
+     *
+     * @param [in] aMesh the mesh to voxelize.
+     * @param [in] aDomain the domain of the voxels.
+     * @param [in] scaleFactor the scale factor to apply to the mesh
+     * (default=1.0)
+     * @return the voxels, sorted by z, then y, then x, without duplicates.
+     * @tparam MeshPoint the type of point of the mesh.
+     */
+    template<typename MeshPoint>
+    Voxels surfaceVoxels(const Mesh<MeshPoint> &aMesh,
+                         const Domain &aDomain,
+                         const double scaleFactor = 1.0);
+
+    /**
+     * Computes the voxels of a domain whose center is inside a closed
+     * mesh. For each line parallel to the z-axis through voxel
+     * centers, the crossings with the faces are computed, and the
+     * voxels between the first and the second crossings, the third
+     * and the fourth, etc, are inside (parity rule). A crossing
+     * through an edge or a vertex is counted once, by a consistent
+     * tie-breaking rule on the edges. The result is meaningful only
+     * if the mesh is closed (a line with an odd number of crossings
+     * is skipped).
+     *
+     * @param [in] aMesh a closed mesh.
+     * @param [in] aDomain the domain of the voxels.
+     * @param [in] scaleFactor the scale factor to apply to the mesh
+     * (default=1.0)
+     * @return the voxels, sorted by z, then y, then x, without duplicates.
+     * @tparam MeshPoint the type of point of the mesh.
+     */
+    template<typename MeshPoint>
+    Voxels interiorVoxels(const Mesh<MeshPoint> &aMesh,
+                          const Domain &aDomain,
+                          const double scaleFactor = 1.0) const;
 
+    /**
+     * Sets the value of the voxels of the digitization of a mesh in an
+     * image (e.g. a binary image), and optionally of the voxels inside
+     * the mesh. The other values are not modified.
+     *
+     * @param [in,out] anImage an image whose domain is of type Domain.
+     * @param [in] aMesh the mesh to voxelize.
+     * @param [in] aValue the value of the voxels of the digitization.
+     * @param [in] scaleFactor the scale factor to apply to the mesh
+     * (default=1.0)
+     * @param [in] solid when 'true', the voxels inside the (closed)
+     * mesh are also set, see interiorVoxels (default=false).
+     * @tparam TImage a model of concepts::CImage.
+     * @tparam MeshPoint the type of point of the mesh.
+     */
+    template<typename TImage, typename MeshPoint>
+    void voxelizeInImage(TImage &anImage,
+                         const Mesh<MeshPoint> &aMesh,
+                         const typename TImage::Value &aValue,
+                         const double scaleFactor = 1.0,
+                         const bool solid = false);
 
     // ----------------------- Internal services ------------------------------
     ///Enum type when deciding if a 2D point belongs to a 2D triangle.
@@ -214,6 +288,58 @@ namespace DGtal
 
   private:
 
+    /// Order of the voxels: by z, then y, then x.
+    struct VoxelOrder
+    {
+      bool operator()(const PointZ3& p, const PointZ3& q) const
+      {
+        return p[2] < q[2] || ( p[2] == q[2] &&
+               ( p[1] < q[1] || ( p[1] == q[1] && p[0] < q[0] ) ) );
+      }
+    };
+
+    /**
+     * Calls a functor on the voxels of the digitization of ABC in a
+     * bounding box (possibly several times on a voxel).
+     * @param A Point A
+     * @param B Point B
+     * @param C Point C
+     * @param n normal of ABC
+     * @param bbox bounding box
+     * @param f a functor called on the voxels
+     * @tparam TFunctor the type of a functor PointZ3 -> void.
+     */
+    template <typename TFunctor>
+    void visitTriangle(const PointR3& A,
+                       const PointR3& B,
+                       const PointR3& C,
+                       const VectorR3& n,
+                       const std::pair<PointZ3, PointZ3>& bbox,
+                       TFunctor& f);
+
+    /**
+     * @param A Point A
+     * @param B Point B
+     * @param C Point C
+     * @return the bounding box of the voxels that may intersect ABC.
+     */
+    static
+    std::pair<PointZ3, PointZ3> boundingBox(const PointR3& A,
+                                           const PointR3& B,
+                                           const PointR3& C);
+
+    /**
+     * Sorts and merges buffers of voxels.
+     * @param [in,out] buffers the buffers, emptied.
+     * @return the voxels of the buffers, sorted by VoxelOrder, without duplicates.
+     */
+    static
+    Voxels mergeVoxels(std::vector< Voxels > &buffers);
+
+    /// @return the number of face ranges processed in parallel.
+    static
+    std::size_t nbChunks();
+
     ///Intersection target
     IntersectionTarget myIntersectionTarget;
   };
@@ -84,6 +84,18 @@ namespace DGtal
      See also SurfaceMeshReader and SurfaceMeshWriter for input/output
      operations for SurfaceMesh.
 
+     The relations between vertices, edges and faces are built from
+     compact arrays (an offset per element and a flat array of
+     indices): edges are obtained by sorting all the face sides at
+     once instead of inserting them in maps, and the neighborhoods
+     are gathered per vertex and per face, in parallel with OpenMP.
+     These arrays are only used during the construction: the
+     relations are stored as one vector per element (the ranges
+     returned by the accessors), each allocated once with its exact
+     size. Likewise, normals and values are transferred between
+     faces and vertices by gathering over the incident faces or
+     vertices of each element, in parallel without write conflicts.
+
      @tparam TRealPoint an arbitrary model of 3D RealPoint.
      @tparam TRealVector an arbitrary model of 3D RealVector.
   */
@@ -612,6 +624,12 @@ namespace DGtal
     /// @return the area of face \a f.
     Scalar faceArea( Index f ) const;
 
+    /// @return the area of each face (computed in parallel with OpenMP).
+    Scalars computeFaceAreas() const;
+
+    /// @return the centroid of each face (computed in parallel with OpenMP).
+    std::vector< RealPoint > computeFaceCentroids() const;
+
     /// @param v any valid vertex index.
     /// @return the Max's weights for each incident face to \a v, in the same order as `myIncidentFaces[ v ]`.
     /// @note Used in computeVertexNormalsFromFaceNormalsWithMaxWeights, see \cite max1999weights
@@ -757,11 +775,31 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   protected:
 
+    /// Computes the incident faces of each vertex from the incident
+    /// vertices of each face.
+    void computeIncidentFaces();
     /// Computes neighboring information.
     void computeNeighbors();
     /// Computes edge information.
     void computeEdges();
 
+    /// Sorts a vector with a stable sort, by chunks in parallel with
+    /// OpenMP, the chunks being then merged two by two.
+    /// @param values the values to sort.
+    /// @param less a strict weak order on the values.
+    template <typename TValue, typename TLess>
+    static void parallelStableSort( std::vector< TValue >& values, const TLess& less );
+
+    /// @return the number of chunks of the parallel loops.
+    static Size nbChunks();
+
+    /// @param v any valid vertex index.
+    /// @param faceAreaFct a functor giving the area of a face.
+    /// @return the Max's weights for each incident face to \a v, see getMaxWeights( Index ).
+    /// @tparam TAreaFunctor the type of a functor Face -> Scalar.
+    template <typename TAreaFunctor>
+    Scalars getMaxWeights( Index v, const TAreaFunctor& faceAreaFct ) const;
+
     /// @return a random number between 0.0 and 1.0
     static Scalar rand01()
     { return (Scalar) rand() / (Scalar) RAND_MAX; }
@@ -42,6 +42,7 @@
 // Inclusions
 #include <iostream>
 #include <array>
+#include <cstdint>
 #include "DGtal/base/Common.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -329,13 +330,25 @@ namespace DGtal
      * triangles as well as the numbering of triangles in the vector
      * \a triangles.
      *
+     * Contrary to the other build methods, the edges are not
+     * computed with a std::set: each arc is keyed by the packed pair
+     * (min,max) of its vertices in a 64-bit integer, the keys are
+     * radix-sorted (in parallel with OpenMP) and opposite arcs are
+     * paired as consecutive keys. All arrays are allocated once from
+     * the face sizes. The resulting structure (numbering of edges and
+     * half-edges included) is the same as the one given by
+     * getUnorderedEdgesFromTriangles() followed by the three
+     * parameters build().
+     *
      * @param[in] triangles the vector of input triangles.
+     *
+     * @return 'true' if everything went well, 'false' if their was
+     * error in the given topology (for instance, an arc belonging to
+     * two triangles).
      */
     bool build( const std::vector<Triangle>& triangles )
     {
-      std::vector<Edge> edges;
-      const Size nbVtx = getUnorderedEdgesFromTriangles( triangles, edges );
-      return build( nbVtx, triangles, edges );
+      return buildFromFaces( triangles );
     }
 
     /**
@@ -344,13 +357,17 @@ namespace DGtal
      * polygonal_faces as well as the numbering of faces in the vector
      * \a polygonal_faces.
      *
+     * The half-edges are paired by radix-sorting arc keys, as in
+     * build( const std::vector<Triangle>& ).
+     *
      * @param[in] polygonal_faces the vector of input polygonal faces.
+     *
+     * @return 'true' if everything went well, 'false' if their was
+     * error in the given topology.
      */
     bool build( const std::vector<PolygonalFace>& polygonal_faces )
     {
-      std::vector<Edge> edges;
-      const Size nbVtx = getUnorderedEdgesFromPolygonalFaces( polygonal_faces, edges );
-      return build( nbVtx, polygonal_faces, edges );
+      return buildFromFaces( polygonal_faces );
     }
 
     /// Clears the data structure.
@@ -1409,6 +1426,48 @@ namespace DGtal
     // ------------------------- Hidden services ------------------------------
   protected:
 
+    /// An arc key (packed ordered pair of vertices) with the index of its arc.
+    typedef std::pair< std::uint64_t, Index > ArcKey;
+
+    /// @return the number of vertices of a triangle, i.e. 3.
+    static Size faceSize( const Triangle& )
+    { return 3; }
+    /// @return the number of vertices of a polygonal face.
+    static Size faceSize( const PolygonalFace& P )
+    { return P.size(); }
+    /// @return the k-th vertex of a triangle.
+    static VertexIndex faceVertex( const Triangle& T, const Size k )
+    { return T.v[ k ]; }
+    /// @return the k-th vertex of a polygonal face.
+    static VertexIndex faceVertex( const PolygonalFace& P, const Size k )
+    { return P[ k ]; }
+
+    /**
+     * Builds the half-edge data structure from faces, by sorting the
+     * (min,max) keys of their arcs. Arc a of face f is the arc from
+     * its vertex a - s to its vertex a - s + 1, s being the number of
+     * arcs of the faces before f.
+     *
+     * @tparam TFace either Triangle or PolygonalFace.
+     * @param[in] faces the vector of input faces.
+     * @return 'true' if everything went well.
+     */
+    template <typename TFace>
+    bool buildFromFaces( const std::vector<TFace>& faces );
+
+    /**
+     * Stable least significant digit radix sort of arc keys, 11 bits
+     * per pass, skipping the high digits that are zero for all keys.
+     * The digits are counted and scattered chunk by chunk, in
+     * parallel with OpenMP.
+     *
+     * @param[in,out] keys the keys to sort.
+     */
+    static void radixSortArcKeys( std::vector< ArcKey >& keys );
+
+    /// @return the number of chunks used for parallel loops.
+    static Size nbChunks();
+
     static
     FaceIndex arc2FaceIndex( const Arc2FaceIndex& de2fi,
                              VertexIndex vi, VertexIndex vj )
@@ -554,6 +554,22 @@ namespace DGtal
       const PointPredicate & pp,
       const SurfelAdjacency<2> &aSAdj );
 
+    /**
+       Converts a 2D contour given as a sequence of surfels into the
+       sequence of its pointels, as done by extractAllPointContours4C
+       for each contour.
+
+       @param aContour (modified) the sequence of contour points.
+       @param aKSpace any space of dimension 2.
+       @param aSCellContour an ordered sequence of surfels, for
+       instance given by track2DBoundary.
+    */
+    static
+    void sCellContourToPoints4C
+    ( std::vector< Point > & aContour,
+      const KSpace & aKSpace,
+      const std::vector< SCell > & aSCellContour );
+
     
 
     /**
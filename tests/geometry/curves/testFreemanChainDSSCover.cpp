@@ -0,0 +1,181 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFreemanChainDSSCover.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class FreemanChainDSSCover.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/curves/ArithmeticalDSS.h"
+#include "DGtal/geometry/curves/FreemanChainDSSCover.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Brute-force tangential cover computed with ArithmeticalDSS.
+///////////////////////////////////////////////////////////////////////////////
+
+template <unsigned short adjacency>
+struct BruteForceCover
+{
+  typedef FreemanChainDSSCover<int, adjacency> Cover;
+  typedef ArithmeticalDSS<int, int, adjacency> DSS;
+  typedef typename Cover::Point Point;
+
+  std::vector<std::size_t> begins, ends;
+  std::vector<DSS> dss;
+
+  /// Codes are read periodically when 'closed' is true.
+  BruteForceCover( const std::vector<unsigned char>& codes, bool closed )
+  {
+    const std::size_t n = codes.size();
+    std::vector<Point> pts( 1, Point( 0, 0 ) );
+    for ( std::size_t k = 0; k < ( closed ? 3 * n : n ); ++k )
+      pts.push_back( pts.back() + Cover::displacement( codes[ k % n ] ) );
+    const std::size_t nbStarts = closed ? n : n + 1;
+    std::vector<std::size_t> last( nbStarts );
+    std::vector<DSS> found;
+    for ( std::size_t i = 0; i < nbStarts; ++i )
+      {
+        DSS s( pts[ i ] );
+        std::size_t j = i;
+        while ( ( j + 1 < pts.size() ) && ( ! closed || j - i < n - 1 )
+                && s.extendFront( pts[ j + 1 ] ) )
+          ++j;
+        last[ i ] = j;
+        found.push_back( s );
+      }
+    for ( std::size_t i = 0; i < nbStarts; ++i )
+      {
+        bool maximal = ( i == 0 ) ? ! closed || ( last[ n - 1 ] < last[ 0 ] + n )
+          : last[ i - 1 ] < last[ i ];
+        if ( maximal )
+          {
+            begins.push_back( i );
+            ends.push_back( last[ i ] + 1 );
+            dss.push_back( found[ i ] );
+          }
+      }
+  }
+};
+
+template <unsigned short adjacency>
+static void checkCover( const std::vector<unsigned char>& codes, bool closed )
+{
+  typedef FreemanChainDSSCover<int, adjacency> Cover;
+  Cover cover;
+  cover.computeFromByteCodes( typename Cover::Point( 0, 0 ), codes, closed );
+  BruteForceCover<adjacency> reference( codes, closed );
+  REQUIRE( cover.isValid() );
+  REQUIRE( cover.size() == reference.begins.size() );
+  for ( std::size_t i = 0; i < cover.size(); ++i )
+    {
+      INFO( "segment " << i << " " << reference.dss[ i ] );
+      REQUIRE( cover.begins()[ i ] == reference.begins[ i ] );
+      REQUIRE( cover.ends()[ i ]   == reference.ends[ i ] );
+      REQUIRE( cover.a()[ i ]      == reference.dss[ i ].a() );
+      REQUIRE( cover.b()[ i ]      == reference.dss[ i ].b() );
+      REQUIRE( cover.mu()[ i ]     == reference.dss[ i ].mu() );
+      REQUIRE( cover.omega( i )    == reference.dss[ i ].omega() );
+    }
+}
+
+/// Random chain made of runs of two consecutive codes.
+static std::vector<unsigned char> randomCodes( unsigned int nb, unsigned int m )
+{
+  std::vector<unsigned char> codes;
+  while ( codes.size() < nb )
+    {
+      const unsigned int c = rand() % m;
+      const unsigned int p = 1 + rand() % 4;
+      const unsigned int l = 1 + rand() % 40;
+      for ( unsigned int k = 0; k < l; ++k )
+        codes.push_back( ( rand() % p == 0 ) ? ( c + 1 ) % m : c );
+    }
+  return codes;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class FreemanChainDSSCover.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing FreemanChainDSSCover" )
+{
+  srand( 0 );
+
+  SECTION( "4-connected open chains match the brute-force cover" )
+    {
+      checkCover<4>( std::vector<unsigned char>(), false );
+      checkCover<4>( { 0 }, false );
+      checkCover<4>( { 0, 1, 0, 0, 1, 0, 0, 1, 2 }, false );
+      for ( unsigned int t = 0; t < 20; ++t )
+        checkCover<4>( randomCodes( 400, 4 ), false );
+    }
+
+  SECTION( "8-connected open chains match the brute-force cover" )
+    {
+      checkCover<8>( { 0, 1, 0, 0, 1, 0, 0, 1, 2, 2, 3 }, false );
+      for ( unsigned int t = 0; t < 20; ++t )
+        checkCover<8>( randomCodes( 400, 8 ), false );
+    }
+
+  SECTION( "Closed chains match the brute-force periodic cover" )
+    {
+      checkCover<4>( { 0, 0, 0, 1, 1, 2, 2, 2, 3, 3 }, true );
+      for ( unsigned int t = 0; t < 10; ++t )
+        {
+          checkCover<4>( randomCodes( 300, 4 ), true );
+          checkCover<8>( randomCodes( 300, 8 ), true );
+        }
+    }
+
+  SECTION( "Packed codes and FreemanChain give the same cover as byte codes" )
+    {
+      typedef FreemanChainDSSCover<int, 4> Cover;
+      std::vector<unsigned char> codes = randomCodes( 1000, 4 );
+      std::string str;
+      for ( auto c : codes ) str.push_back( char( '0' + c ) );
+      FreemanChain<int> fc( str, 3, -2 );
+      Cover byBytes, byPacked, byChain;
+      byBytes.computeFromByteCodes( Cover::Point( 3, -2 ), Cover::toByteCodes( str ) );
+      Cover::PackedCodes packed = Cover::toPackedCodes( str.begin(), str.end() );
+      REQUIRE( packed.size() == ( codes.size() + 31 ) / 32 );
+      byPacked.computeFromPackedCodes( Cover::Point( 3, -2 ), packed, codes.size() );
+      byChain.computeFromFreemanChain( fc );
+      REQUIRE( byBytes.size() == byPacked.size() );
+      REQUIRE( byBytes.size() == byChain.size() );
+      REQUIRE( byBytes.begins() == byPacked.begins() );
+      REQUIRE( byBytes.ends()   == byChain.ends() );
+      REQUIRE( byBytes.mu()     == byPacked.mu() );
+      REQUIRE( byBytes.mu()     == byChain.mu() );
+    }
+}
+
+/** @ingroup Tests **/
@@ -0,0 +1,175 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPackedFreemanChain.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class PackedFreemanChain.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/parametric/Flower2D.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/geometry/curves/PackedFreemanChain.h"
+#include "DGtal/geometry/curves/FreemanChainDSSCover.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PackedFreemanChain.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing PackedFreemanChain" )
+{
+  typedef PackedFreemanChain<int> PackedChain;
+  typedef FreemanChain<int> Chain;
+
+  srand( 0 );
+  std::string codes;
+  for ( unsigned int k = 0; k < 2000; ++k )
+    codes.push_back( char( '0' + rand() % 4 ) );
+  Chain fc( codes, 5, -7 );
+  PackedChain pc( fc );
+
+  SECTION( "Codes and points are those of the FreemanChain" )
+    {
+      REQUIRE( pc.isValid() );
+      REQUIRE( pc.size() == codes.size() );
+      REQUIRE( pc.firstPoint() == fc.firstPoint() );
+      REQUIRE( pc.lastPoint() == fc.lastPoint() );
+      std::vector<Chain::Point> points;
+      Chain::getContourPoints( fc, points );
+      REQUIRE( points.size() == pc.size() + 1 );
+      bool sameCodes = true, samePoints = true;
+      for ( unsigned int k = 0; k < pc.size(); ++k )
+        sameCodes = sameCodes && ( pc.code( k ) == fc.code( k ) );
+      for ( unsigned int k = 0; k <= pc.size(); ++k )
+        samePoints = samePoints && ( pc.point( k ) == points[ k ] );
+      REQUIRE( sameCodes );
+      REQUIRE( samePoints );
+      REQUIRE( pc.toFreemanChain() == fc );
+    }
+
+  SECTION( "Iterators visit the points of the chain" )
+    {
+      std::vector<Chain::Point> points;
+      Chain::getContourPoints( fc, points );
+      REQUIRE( std::distance( pc.begin(), pc.end() ) == (std::ptrdiff_t) points.size() );
+      REQUIRE( std::equal( pc.begin(), pc.end(), points.begin() ) );
+      PackedChain::ConstIterator it = pc.begin() + 777;
+      REQUIRE( *it == points[ 777 ] );
+      --it;
+      REQUIRE( *it == points[ 776 ] );
+      it += 1000;
+      REQUIRE( *it == points[ 1776 ] );
+    }
+
+  SECTION( "Iterators stop at the last point of chains of 0 or 32k codes" )
+    {
+      PackedChain empty( 3, 4 );
+      REQUIRE( std::distance( empty.begin(), empty.end() ) == 1 );
+      REQUIRE( *empty.begin() == Chain::Point( 3, 4 ) );
+      PackedChain::ConstIterator itEmpty = empty.end();
+      --itEmpty;
+      REQUIRE( *itEmpty == Chain::Point( 3, 4 ) );
+      for ( unsigned int n : { 32, 64, 256, 512 } )
+        {
+          Chain fcn( codes.substr( 0, n ), 5, -7 );
+          PackedChain pcn( fcn );
+          std::vector<Chain::Point> points;
+          Chain::getContourPoints( fcn, points );
+          REQUIRE( pcn.size() == n );
+          REQUIRE( std::equal( pcn.begin(), pcn.end(), points.begin() ) );
+          // Reverse iteration from end() visits the points backwards.
+          bool sameReversed = true;
+          std::size_t k = points.size();
+          for ( PackedChain::ConstIterator it = pcn.end(); it != pcn.begin(); )
+            {
+              --it; --k;
+              sameReversed = sameReversed && ( *it == points[ k ] );
+            }
+          REQUIRE( sameReversed );
+          REQUIRE( k == 0 );
+          REQUIRE( *( pcn.end() - 1 ) == points.back() );
+        }
+    }
+
+  SECTION( "Packed chains use 2 bits per code" )
+    {
+      REQUIRE( pc.words().size() == ( codes.size() + 31 ) / 32 );
+      REQUIRE( pc.memorySize() * 3 < codes.size() );
+    }
+
+  SECTION( "Points ranges are converted into codes" )
+    {
+      std::vector<Chain::Point> points;
+      Chain::getContourPoints( fc, points );
+      PackedChain pc2;
+      pc2.initFromPointsRange( points.begin(), points.end() );
+      REQUIRE( pc2.toFreemanChain() == fc );
+      points[ 10 ] += Chain::Point( 3, 0 );
+      REQUIRE_THROWS_AS( pc2.initFromPointsRange( points.begin(), points.end() ),
+                         ConnectivityException );
+    }
+
+  SECTION( "Boundaries are tracked into closed packed chains" )
+    {
+      typedef Z2i::Space Space;
+      typedef Z2i::KSpace KSpace;
+      typedef Flower2D<Space> Flower;
+      typedef GaussDigitizer<Space, Flower> Digitizer;
+      Flower flower( 0.5, 0.5, 20.0, 5.0, 5, 0.3 );
+      Digitizer dig;
+      dig.attach( flower );
+      dig.init( flower.getLowerBound(), flower.getUpperBound(), 0.5 );
+      KSpace K;
+      K.init( dig.getLowerBound(), dig.getUpperBound(), true );
+      SurfelAdjacency<KSpace::dimension> SAdj( true );
+      KSpace::SCell bel = Surfaces<KSpace>::findABel( K, dig, 10000 );
+      std::vector<Z2i::Point> points;
+      Surfaces<KSpace>::track2DBoundaryPoints( points, K, SAdj, dig, bel );
+      PackedChain boundary;
+      boundary.initFromBoundary( K, SAdj, dig, bel );
+      REQUIRE( boundary.size() == points.size() );
+      REQUIRE( boundary.lastPoint() == boundary.firstPoint() );
+      REQUIRE( std::equal( points.begin(), points.end(), boundary.begin() ) );
+
+      // The packed codes can be processed without unpacking.
+      FreemanChainDSSCover<int, 4> fromPacked, fromChain;
+      fromPacked.computeFromPackedCodes( boundary.firstPoint(), boundary.words(),
+                                         boundary.size(), true );
+      fromChain.computeFromFreemanChain( boundary.toFreemanChain(), true );
+      REQUIRE( fromPacked.size() > 0 );
+      REQUIRE( fromPacked.begins() == fromChain.begins() );
+      REQUIRE( fromPacked.mu() == fromChain.mu() );
+    }
+}
+
+/** @ingroup Tests **/
@@ -30,6 +30,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <cstdlib>
 #include <iostream>
+#include <set>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/kernel/CPointPredicate.h"
@@ -279,22 +281,23 @@ checkPlanes( unsigned int nbplanes, int diameter, unsigned int nbtries )
 /**
  * Example of a test. To be completed.
  *
+ * @tparam Integer the internal integer type of the computers.
  */
+template <typename Integer>
 bool testCOBANaivePlaneComputer()
 {
   unsigned int nbok = 0;
   unsigned int nb = 0;
   using namespace Z3i;
-  typedef BigInteger Integer;
-  typedef COBANaivePlaneComputer<Z3, BigInteger> NaivePlaneComputer;
-  typedef COBAGenericNaivePlaneComputer<Z3, BigInteger> GenericNaivePlaneComputer;
+  typedef COBANaivePlaneComputer<Z3, Integer> NaivePlaneComputer;
+  typedef COBAGenericNaivePlaneComputer<Z3, Integer> GenericNaivePlaneComputer;
 
   BOOST_CONCEPT_ASSERT(( CAdditivePrimitiveComputer< NaivePlaneComputer > ));
   BOOST_CONCEPT_ASSERT(( CAdditivePrimitiveComputer< GenericNaivePlaneComputer > ));
   BOOST_CONCEPT_ASSERT(( boost::ForwardContainer< NaivePlaneComputer > ));
   BOOST_CONCEPT_ASSERT(( boost::ForwardContainer< GenericNaivePlaneComputer > ));
-  BOOST_CONCEPT_ASSERT(( CPointPredicate< NaivePlaneComputer::Primitive > ));
-  BOOST_CONCEPT_ASSERT(( CPointPredicate< GenericNaivePlaneComputer::Primitive > ));
+  BOOST_CONCEPT_ASSERT(( CPointPredicate< typename NaivePlaneComputer::Primitive > ));
+  BOOST_CONCEPT_ASSERT(( CPointPredicate< typename GenericNaivePlaneComputer::Primitive > ));
 
   trace.beginBlock ( "Testing block: COBANaivePlaneComputer instantiation." );
   NaivePlaneComputer plane;
@@ -334,6 +337,20 @@ bool testCOBANaivePlaneComputer()
   trace.info() << "(" << nbok << "/" << nb << ") add " << pt5
                << " Plane=" << plane << std::endl;
 
+  // Points already in the plane are stored once.
+  const typename NaivePlaneComputer::Size size = plane.size();
+  bool pt1_again = plane.isExtendable( pt1 ) && plane.extend( pt1 )
+    && plane.extendAsIs( pt2 );
+  const Point pts[] = { pt0, pt5, pt5 };
+  pt1_again = pt1_again && plane.extend( pts, pts + 3 );
+  std::size_t nbIterated = 0;
+  for ( typename NaivePlaneComputer::ConstIterator it = plane.begin(), itE = plane.end();
+        it != itE; ++it )
+    ++nbIterated;
+  ++nb; nbok += ( pt1_again && plane.size() == size && nbIterated == size ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") add again " << pt0 << pt1 << pt2 << pt5
+               << " size=" << plane.size() << std::endl;
+
   NaivePlaneComputer plane2;
   plane2.init( 2, 100, 1, 1 );
   plane2.extend( Point( 10, 0, 0 ) );
@@ -478,6 +495,87 @@ checkExtendWithManyPoints( unsigned int diameter,
   return nb == nbok;
 }
 
+/**
+ * Checks that extending by batches of points gives a plane containing
+ * all of them, and that a failed batch leaves the object unchanged.
+ */
+template <typename NaivePlaneComputer>
+bool
+checkBatchedExtend( unsigned int diameter,
+                    unsigned int nbplanes,
+                    unsigned int nbpoints,
+                    unsigned int batchSize )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  typedef typename NaivePlaneComputer::InternalInteger Integer;
+  typedef typename NaivePlaneComputer::Point Point;
+  typedef typename Point::Coordinate PointInteger;
+  IntegerComputer<Integer> ic;
+
+  trace.beginBlock( "checkBatchedExtend" );
+  for ( unsigned int j = 0; j < nbplanes; ++j )
+    {
+      Integer a = getRandomInteger<Integer>( (Integer) 0, (Integer) diameter / 2 ); 
+      Integer b = getRandomInteger<Integer>( (Integer) 0, (Integer) diameter / 2 ); 
+      Integer c = getRandomInteger<Integer>( (Integer) 1, (Integer) diameter / 2 ); 
+      Integer d = getRandomInteger<Integer>( (Integer) 0, (Integer) diameter / 2 ); 
+      Dimension axis;
+      if ( ( a >= b ) && ( a >= c ) )       axis = 0;
+      else if ( ( b >= a ) && ( b >= c ) )  axis = 1;
+      else                                  axis = 2;
+      std::vector<Point> pts;
+      for ( unsigned int i = 0; i < nbpoints; ++i )
+        {
+          Point p;
+          p[ 0 ] = getRandomInteger<PointInteger>( -diameter+1, diameter ); 
+          p[ 1 ] = getRandomInteger<PointInteger>( -diameter+1, diameter ); 
+          p[ 2 ] = getRandomInteger<PointInteger>( -diameter+1, diameter );
+          Integer x = (Integer) p[ 0 ];
+          Integer y = (Integer) p[ 1 ];
+          Integer z = (Integer) p[ 2 ];
+          switch( axis ) {
+          case 0: p[ 0 ] = NumberTraits<Integer>::castToInt64_t( ic.ceilDiv( d - b * y - c * z, a ) ); break;
+          case 1: p[ 1 ] = NumberTraits<Integer>::castToInt64_t( ic.ceilDiv( d - a * x - c * z, b ) ); break;
+          case 2: p[ 2 ] = NumberTraits<Integer>::castToInt64_t( ic.ceilDiv( d - a * x - b * y, c ) ); break;
+          }
+          pts.push_back( p );
+        }
+      NaivePlaneComputer plane;
+      plane.init( axis, diameter, 1, 1 );
+      bool ok = true;
+      for ( unsigned int i = 0; i < pts.size(); i += batchSize )
+        {
+          unsigned int k = std::min( (unsigned int) pts.size(), i + batchSize );
+          ok = ok && plane.isExtendable( pts.begin() + i, pts.begin() + k );
+          ok = ok && plane.extend( pts.begin() + i, pts.begin() + k );
+        }
+      std::set<Point> distinct( pts.begin(), pts.end() );
+      ok = ok && ( plane.size() == distinct.size() );
+      for ( unsigned int i = 0; i < pts.size(); ++i )
+        ok = ok && plane( pts[ i ] );
+      ++nb; nbok += ok ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb 
+                   << ") plane.extend( batch ) contains all points"
+                   << std::endl;
+      // A point above the plane makes the next batch fail.
+      const Point n = axis == 0 ? Point( 1, 0, 0 ) : ( axis == 1 ? Point( 0, 1, 0 ) : Point( 0, 0, 1 ) );
+      std::vector<Point> bad( pts.begin(), pts.begin() + std::min( (unsigned int) pts.size(), batchSize ) );
+      bad.push_back( pts.back() + n );
+      NaivePlaneComputer copy( plane );
+      bool check = ! plane.isExtendable( bad.begin(), bad.end() )
+        && ! plane.extend( bad.begin(), bad.end() )
+        && ( plane.size() == copy.size() )
+        && ( plane.exactNormal() == copy.exactNormal() );
+      ++nb; nbok += check ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb 
+                   << ") ! plane.extend( bad batch ) and plane is unchanged"
+                   << std::endl;
+    }
+  trace.endBlock();
+  return nb == nbok;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -488,11 +586,19 @@ int main( int /*argc*/, char** /*argv*/ )
   // Max diameter is ~20 for int32_t, ~500 for int64_t, any with BigInteger.
   trace.beginBlock ( "Testing class COBANaivePlaneComputer" );
   bool res = true 
-    && testCOBANaivePlaneComputer()
+    && testCOBANaivePlaneComputer<DGtal::int64_t>()
+#ifdef WITH_GMP
+    && testCOBANaivePlaneComputer<DGtal::BigInteger>()
+#endif
     && checkManyPlanes<COBANaivePlaneComputer<Z3, DGtal::int32_t> >( 20, 100, 200 )
     && checkManyPlanes<COBANaivePlaneComputer<Z3, DGtal::int64_t> >( 500, 100, 200 )
+#ifdef WITH_GMP
     && checkManyPlanes<COBANaivePlaneComputer<Z3, DGtal::BigInteger> >( 10000, 10, 200 )
-    && checkExtendWithManyPoints<COBAGenericNaivePlaneComputer<Z3, DGtal::int64_t> >( 100, 100, 200 );
+#endif
+    && checkExtendWithManyPoints<COBAGenericNaivePlaneComputer<Z3, DGtal::int64_t> >( 100, 100, 200 )
+    && checkBatchedExtend<COBANaivePlaneComputer<Z3, DGtal::int64_t> >( 100, 50, 300, 1 )
+    && checkBatchedExtend<COBANaivePlaneComputer<Z3, DGtal::int64_t> >( 100, 50, 300, 17 )
+    && checkBatchedExtend<COBANaivePlaneComputer<Z3, DGtal::int64_t> >( 100, 50, 300, 300 );
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
@@ -33,6 +33,7 @@
 #include "ConfigTest.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/geometry/surfaces/estimation/EstimatorCache.h"
+#include "DGtal/geometry/surfaces/estimation/IndexedEstimatorCache.h"
 ///
 /// Shape
 #include "DGtal/shapes/implicit/ImplicitBall.h"
@@ -188,6 +189,103 @@ bool testEstimatorCache(double h)
   return nbok == nb;
 }
 
+/**
+ * Checks that IndexedEstimatorCache gives the values of the estimator
+ * by index and by surfel, with a sequential and a parallel fill.
+ *
+ */
+bool testIndexedEstimatorCache(double h)
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef ImplicitBall<Z3i::Space> ImplicitShape;
+  typedef GaussDigitizer<Z3i::Space, ImplicitShape> DigitalShape;
+  typedef LightImplicitDigitalSurface<Z3i::KSpace,DigitalShape> Boundary;
+  typedef DigitalSurface< Boundary > MyDigitalSurface;
+  typedef DepthFirstVisitor< MyDigitalSurface > Visitor;
+  typedef GraphVisitorRange< Visitor > VisitorRange;
+
+  typedef functors::IIGaussianCurvature3DFunctor<Z3i::Space> MyIICurvatureFunctor;
+  typedef IntegralInvariantCovarianceEstimator< Z3i::KSpace, DigitalShape, MyIICurvatureFunctor > MyIICurvatureEstimator;
+  typedef IndexedEstimatorCache<MyIICurvatureEstimator> GaussianCache;
+
+  BOOST_CONCEPT_ASSERT(( concepts::CSurfelLocalEstimator<GaussianCache> ));
+
+  double re = 5.0;
+  double radius = 5.0;
+
+  trace.beginBlock( "Shape initialisation ..." );
+
+  ImplicitShape ishape( Z3i::RealPoint( 0.2, 0.1, 0.4 ), radius );
+  DigitalShape dshape;
+  dshape.attach( ishape );
+  dshape.init( Z3i::RealPoint( -10.0, -10.0, -10.0 ), Z3i::RealPoint( 10.0, 10.0, 10.0 ), h );
+
+  Z3i::KSpace K;
+  if ( !K.init( dshape.getLowerBound(), dshape.getUpperBound(), true ) )
+  {
+    trace.error() << "Problem with Khalimsky space" << std::endl;
+    return false;
+  }
+
+  Z3i::KSpace::Surfel bel = Surfaces<Z3i::KSpace>::findABel( K, dshape, 10000 );
+  Boundary boundary( K, dshape, SurfelAdjacency<Z3i::KSpace::dimension>( true ), bel );
+  MyDigitalSurface surf ( boundary );
+
+  std::vector<Z3i::SCell> surfels;
+  VisitorRange range( new Visitor( surf, *surf.begin() ));
+  for ( VisitorRange::ConstIterator it = range.begin(), itend = range.end(); it != itend; ++it )
+    surfels.push_back( *it );
+  trace.endBlock();
+
+  trace.beginBlock( "Caching values ...");
+  MyIICurvatureFunctor curvatureFunctor;
+  curvatureFunctor.init( h, re );
+
+  MyIICurvatureEstimator curvatureEstimator( curvatureFunctor );
+  curvatureEstimator.attach( K, dshape );
+  curvatureEstimator.setParams( re/h );
+
+  GaussianCache cache( curvatureEstimator );
+  cache.init( h, surfels.begin(), surfels.end() );
+  GaussianCache parallelCache( curvatureEstimator, true );
+  parallelCache.init( h, surfels.begin(), surfels.end() );
+  trace.info() << cache << " " << parallelCache << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock( "Complete test ...");
+  bool ok = cache.isValid() && cache.size() == surfels.size()
+    && parallelCache.values() == cache.values();
+  for ( GaussianCache::Index i = 0; i < surfels.size(); ++i )
+    {
+      const MyIICurvatureEstimator::Quantity expected = curvatureEstimator.eval( surfels.begin() + i );
+      if ( cache.value( i ) != expected
+           || cache.eval( surfels[ i ] ) != expected
+           || cache.index( surfels[ i ] ) != i )
+        {
+          ok = false;
+          trace.error() << "Incorrect values at "<<surfels[ i ]<<" read " <<cache.value( i )<< " and expecting "<<expected<<std::endl;
+        }
+    }
+  for(MyDigitalSurface::ConstIterator it = surf.begin(), itend=surf.end(); it != itend; ++it)
+    if ( cache.eval( it ) != cache.value( cache.index( *it ) ) ) ok = false;
+  // A surfel of the opposite orientation is not in the cache.
+  if ( cache.index( K.sOpp( surfels[ 0 ] ) ) != cache.size() ) ok = false;
+  bool thrown = false;
+  try { cache.eval( K.sOpp( surfels[ 0 ] ) ); }
+  catch ( InputException & ) { thrown = true; }
+  if ( ! thrown ) ok = false;
+  trace.endBlock();
+
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "indexed cache == eval" << std::endl;
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -199,7 +297,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testEstimatorCache( 0.8 ); // && ... other tests
+  bool res = testEstimatorCache( 0.8 ) && testIndexedEstimatorCache( 0.8 ); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
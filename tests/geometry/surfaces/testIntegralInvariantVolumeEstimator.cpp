@@ -220,6 +220,23 @@ bool testMeanCurvature3d( double h, double delta )
 
   trace.endBlock();
 
+  trace.beginBlock ( "Comparing sliding and full kernel evaluations ..." );
+
+  unsigned int nbDiff = 0;
+  unsigned int index = 0;
+  VisitorRange range2( new Visitor( surf, *surf.begin() ));
+  for ( VisitorConstIterator it = range2.begin(), itEnd = range2.end(); it != itEnd; ++it, ++index )
+    if ( results[ index ] != curvatureEstimator.eval( it ) ) ++nbDiff;
+  trace.info() << "(" << nbDiff << "/" << index << ") evaluations differ." << std::endl;
+
+  if ( nbDiff != 0 || index != results.size() )
+  {
+    trace.endBlock();
+    return false;
+  }
+
+  trace.endBlock();
+
   trace.beginBlock ( "Comparing results of integral invariant 3D mean curvature ..." );
 
   double mean = 0.0;
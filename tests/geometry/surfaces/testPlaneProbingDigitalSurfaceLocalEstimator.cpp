@@ -0,0 +1,182 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing classes DGtal::PlaneProbingDigitalSurfaceLocalEstimator
+ * and DGtal::PackedDigitalSurfacePredicate.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/geometry/surfaces/DigitalSurfacePredicate.h"
+#include "DGtal/geometry/surfaces/PackedDigitalSurfacePredicate.h"
+#include "DGtal/geometry/surfaces/estimation/PlaneProbingTetrahedronEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/PlaneProbingParallelepipedEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/PlaneProbingDigitalSurfaceLocalEstimator.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+using KSpace  = Z3i::KSpace;
+using SH3     = Shortcuts<KSpace>;
+using Surface = SH3::DigitalSurface;
+using Point   = SH3::Point;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PlaneProbingDigitalSurfaceLocalEstimator.
+///////////////////////////////////////////////////////////////////////////////
+
+template < typename ProbingAlgorithm, typename ReferenceAlgorithm, typename Factory >
+void checkEvalBatch (CountedPtr<Surface> surface, SH3::SurfelRange const& surfels, Factory const& factory)
+{
+    using Estimator          = PlaneProbingDigitalSurfaceLocalEstimator<Surface, ProbingAlgorithm>;
+    using ReferenceEstimator = PlaneProbingDigitalSurfaceLocalEstimator<Surface, ReferenceAlgorithm>;
+
+    typename ReferenceEstimator::ProbingFactory referenceFactory =
+        [&factory] (typename ReferenceEstimator::ProbingFrame const& frame,
+                    typename ReferenceEstimator::Predicate const& predicate)
+        { return factory.template make<ReferenceAlgorithm>(frame, predicate); };
+    ReferenceEstimator reference(surface, referenceFactory);
+    reference.init(1.0, surfels.begin(), surfels.end());
+    std::vector<typename ReferenceEstimator::Quantity> expected;
+    reference.eval(surfels.begin(), surfels.end(), std::back_inserter(expected));
+
+    typename Estimator::ProbingFactory probingFactory =
+        [&factory] (typename Estimator::ProbingFrame const& frame,
+                    typename Estimator::Predicate const& predicate)
+        { return factory.template make<ProbingAlgorithm>(frame, predicate); };
+
+    Estimator estimator(surface, probingFactory);
+    estimator.init(1.0, surfels.begin(), surfels.end());
+    std::vector<typename Estimator::Quantity> sequential;
+    estimator.eval(surfels.begin(), surfels.end(), std::back_inserter(sequential));
+    REQUIRE( sequential == expected );
+
+    for (std::size_t chunkSize : { 1, 7, 256 })
+    {
+        Estimator batchEstimator(surface, probingFactory);
+        batchEstimator.init(1.0, surfels.begin(), surfels.end());
+        std::vector<typename Estimator::Quantity> batch;
+        batchEstimator.evalBatch(surfels.begin(), surfels.end(), std::back_inserter(batch), chunkSize);
+        REQUIRE( batch == expected );
+        if (chunkSize == 1)
+        {
+            REQUIRE( batchEstimator.nbReusedRuns() == 0 );
+        }
+        else if (chunkSize == 256)
+        {
+            REQUIRE( batchEstimator.nbReusedRuns() > 0 );
+        }
+    }
+}
+
+struct TetrahedronFactory
+{
+    template < typename Algorithm, typename Frame, typename Predicate >
+    Algorithm* make (Frame const& frame, Predicate const& predicate) const
+    {
+        return new Algorithm(frame.p, { frame.b1, frame.b2, frame.normal }, predicate);
+    }
+};
+
+struct ParallelepipedFactory
+{
+    template < typename Algorithm, typename Frame, typename Predicate >
+    Algorithm* make (Frame const& frame, Predicate const& predicate) const
+    {
+        return new Algorithm(frame.p, { frame.b1, frame.b2, frame.normal }, predicate, 100);
+    }
+};
+
+TEST_CASE( "Testing PlaneProbingDigitalSurfaceLocalEstimator" )
+{
+    auto params   = SH3::defaultParameters();
+    params( "polynomial", "4*x^2+y^2+2*z^2-300" )( "gridstep", 1.0 )
+          ( "minAABB", -20 )( "maxAABB", 20 );
+    auto shape    = SH3::makeImplicitShape3D( params );
+    auto dshape   = SH3::makeDigitizedImplicitShape3D( shape, params );
+    auto bimage   = SH3::makeBinaryImage( dshape, params );
+    auto K        = SH3::getKSpace( bimage, params );
+    auto surface  = SH3::makeDigitalSurface( bimage, K, params );
+    auto surfels  = SH3::getSurfelRange( surface, params );
+    REQUIRE( surfels.size() > 1000 );
+
+    using SurfacePredicate       = DigitalSurfacePredicate<Surface>;
+    using PackedSurfacePredicate = PackedDigitalSurfacePredicate<Surface>;
+
+    SECTION( "The packed predicate has the pointels of the digital surface" )
+    {
+        SurfacePredicate predicate(surface);
+        PackedSurfacePredicate packed(surface);
+        REQUIRE( packed.isValid() );
+        Z3i::Domain box(packed.lowerBound() - Point::diagonal(2), packed.upperBound() + Point::diagonal(2));
+        unsigned int nbDifferences = 0, nbInside = 0;
+        for (auto p : box)
+        {
+            if (predicate(p) != packed(p)) ++nbDifferences;
+            if (packed(p)) ++nbInside;
+        }
+        REQUIRE( nbDifferences == 0 );
+        REQUIRE( nbInside > 0 );
+
+        PackedSurfacePredicate::QueryLog log;
+        PackedSurfacePredicate copy(packed);
+        copy.setQueryLog(&log);
+        for (auto p : box)
+        {
+            copy(p);
+        }
+        REQUIRE( log.size() == box.size() );
+        REQUIRE( copy.isTranslationInvariant(log, Point::zero) );
+        REQUIRE( ! copy.isTranslationInvariant(log, Point(1, 0, 0)) );
+    }
+
+    SECTION( "Batch evaluation with tetrahedron estimators" )
+    {
+        checkEvalBatch< PlaneProbingTetrahedronEstimator<PackedSurfacePredicate, ProbingMode::H>,
+                        PlaneProbingTetrahedronEstimator<SurfacePredicate, ProbingMode::H> >
+            (surface, surfels, TetrahedronFactory());
+        checkEvalBatch< PlaneProbingTetrahedronEstimator<PackedSurfacePredicate, ProbingMode::R>,
+                        PlaneProbingTetrahedronEstimator<SurfacePredicate, ProbingMode::R> >
+            (surface, surfels, TetrahedronFactory());
+    }
+
+    SECTION( "Batch evaluation with parallelepiped estimators" )
+    {
+        checkEvalBatch< PlaneProbingParallelepipedEstimator<PackedSurfacePredicate, ProbingMode::R1>,
+                        PlaneProbingParallelepipedEstimator<SurfacePredicate, ProbingMode::R1> >
+            (surface, surfels, ParallelepipedFactory());
+        checkEvalBatch< PlaneProbingParallelepipedEstimator<PackedSurfacePredicate, ProbingMode::H>,
+                        PlaneProbingParallelepipedEstimator<SurfacePredicate, ProbingMode::H> >
+            (surface, surfels, ParallelepipedFactory());
+    }
+}
+
+/** @ingroup Tests **/
@@ -0,0 +1,126 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testContourPipeline.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class ContourPipeline.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/geometry/helpers/ContourPipeline.h"
+#include "DGtal/geometry/curves/PackedFreemanChain.h"
+#include "DGtal/geometry/curves/FreemanChainDSSCover.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z2i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ContourPipeline.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing ContourPipeline" )
+{
+  // Random disks, a large ring and some noise: many contours, some of
+  // them crossing many strips, some nested.
+  const Point low( -37, -20 ), up( 60, 75 );
+  Domain domain( low, up );
+  DigitalSet shape( domain );
+  srand( 3 );
+  for ( unsigned int i = 0; i < 25; ++i )
+    {
+      const Point c( low[ 0 ] + rand() % 98, low[ 1 ] + rand() % 96 );
+      const int r = 1 + rand() % 6;
+      for ( auto p : domain )
+        if ( ( p - c ).dot( p - c ) <= r * r ) shape.insertNew( p );
+    }
+  for ( auto p : domain )
+    {
+      const int d2 = ( p - Point( 10, 25 ) ).dot( p - Point( 10, 25 ) );
+      if ( ( 30 * 30 <= d2 && d2 <= 34 * 34 ) || rand() % 50 == 0 )
+        shape.insert( p );
+    }
+  const DigitalSet & inShape = shape;
+
+  KSpace K;
+  K.init( low, up, true );
+  SurfelAdjacency<2> SAdj( true );
+
+  SECTION( "Surfel contours are those of the sequential extraction" )
+    {
+      std::vector< std::vector<SCell> > expected;
+      Surfaces<KSpace>::extractAll2DSCellContours( expected, K, SAdj, inShape );
+      REQUIRE( expected.size() > 50 );
+      for ( std::size_t nb : { 1, 2, 3, 7, 16, 200 } )
+        {
+          ContourPipeline<KSpace> pipeline( K, SAdj, nb );
+          REQUIRE( pipeline.isValid() );
+          std::vector< std::vector<SCell> > contours;
+          pipeline.extractAll2DSCellContours( contours, inShape );
+          REQUIRE( contours == expected );
+        }
+    }
+
+  SECTION( "Point contours are those of the sequential extraction" )
+    {
+      std::vector< std::vector<Point> > expected, contours;
+      Surfaces<KSpace>::extractAllPointContours4C( expected, K, inShape, SAdj );
+      ContourPipeline<KSpace> pipeline( K, SAdj );
+      pipeline.extractAllPointContours4C( contours, inShape );
+      REQUIRE( contours == expected );
+    }
+
+  SECTION( "Per-contour estimators are returned in contour order" )
+    {
+      ContourPipeline<KSpace> pipeline( K, SAdj, 5 );
+      std::vector< std::vector<SCell> > contours;
+      pipeline.extractAll2DSCellContours( contours, inShape );
+      auto estimator = [ & ] ( const std::vector<SCell> & c )
+        {
+          // Contours touching the domain border are open.
+          std::vector<Point> points;
+          Surfaces<KSpace>::track2DBoundaryPoints( points, K, SAdj, inShape, c.front() );
+          PackedFreemanChain<Integer> chain;
+          chain.initFromPointsRange( points.begin(), points.end() );
+          FreemanChainDSSCover<Integer, 4> cover;
+          cover.computeFromPackedCodes( chain.firstPoint(), chain.words(),
+                                        chain.size(), false );
+          return cover.size();
+        };
+      auto nbSegments = ContourPipeline<KSpace>::apply( contours, estimator );
+      REQUIRE( nbSegments.size() == contours.size() );
+      bool sameResults = true;
+      for ( std::size_t i = 0; i < contours.size(); ++i )
+        sameResults = sameResults && ( estimator( contours[ i ] ) == nbSegments[ i ] );
+      REQUIRE( sameResults );
+    }
+}
+
+/** @ingroup Tests **/
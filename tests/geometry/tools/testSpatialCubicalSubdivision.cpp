@@ -0,0 +1,185 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSpatialCubicalSubdivision.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class SpatialCubicalSubdivision.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/tools/SpatialCubicalSubdivision.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Z3i::Space                                 Space;
+typedef Z3i::Point                                 Point;
+typedef SpatialCubicalSubdivision< Space >         Subdivision;
+typedef Subdivision::Indices                       Indices;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SpatialCubicalSubdivision.
+///////////////////////////////////////////////////////////////////////////////
+
+double squaredDistance( const Point& p, const Point& q )
+{
+  const Point d = p - q;
+  return (double) d.dot( d );
+}
+
+SCENARIO( "SpatialCubicalSubdivision proximity queries", "[SpatialCubicalSubdivision]" )
+{
+  const Point lo( -20, -10, 0 );
+  const Point up(  30,  25, 17 );
+  std::mt19937 gen( 3 );
+  std::uniform_int_distribution<int> X( -20, 30 ), Y( -10, 25 ), Z( 0, 17 );
+  std::vector<Point> points( 20000 );
+  for ( auto& p : points ) p = Point( X( gen ), Y( gen ), Z( gen ) );
+  std::vector<Point> queries( 200 );
+  for ( auto& q : queries ) q = Point( X( gen ) + 3, Y( gen ) - 2, Z( gen ) );
+  Subdivision S( lo, up, 4 );
+  S.push( points.begin(), points.end() );
+
+  GIVEN( "Random points pushed as a range" )
+    {
+      THEN( "Points keep their index and are stored in their bin" )
+        {
+          REQUIRE( S.isValid() );
+          REQUIRE( S.nbPoints() == points.size() );
+          unsigned int nbErrors = 0;
+          for ( Subdivision::Index i = 0; i < points.size(); ++i )
+            if ( S.point( i ) != points[ i ] ) ++nbErrors;
+          for ( auto b : S.binDomain() )
+            {
+              Indices indices;
+              S.getIndices( indices, b, b );
+              for ( auto i : indices )
+                if ( S.bin( points[ i ] ) != b ) ++nbErrors;
+              if ( ! std::is_sorted( indices.begin(), indices.end() ) ) ++nbErrors;
+            }
+          Indices all;
+          S.getIndices( all, S.binDomain().lowerBound(), S.binDomain().upperBound() );
+          REQUIRE( all.size() == points.size() );
+          REQUIRE( nbErrors == 0 );
+        }
+      THEN( "Ball queries return the points within the radius" )
+        {
+          const double radius = 5.5;
+          auto result = S.getIndicesInBalls( queries, radius );
+          unsigned int nbErrors = 0;
+          for ( std::size_t j = 0; j < queries.size(); ++j )
+            {
+              Indices expected;
+              for ( Subdivision::Index i = 0; i < points.size(); ++i )
+                if ( squaredDistance( points[ i ], queries[ j ] ) <= radius * radius )
+                  expected.push_back( i );
+              if ( result[ j ] != expected ) ++nbErrors;
+            }
+          REQUIRE( nbErrors == 0 );
+        }
+      THEN( "kNN queries return the closest points" )
+        {
+          for ( std::size_t k : { 1, 7, 50 } )
+            {
+              auto result = S.getKNearestIndices( queries, k );
+              unsigned int nbErrors = 0;
+              for ( std::size_t j = 0; j < queries.size(); ++j )
+                {
+                  std::vector< std::pair<double,Subdivision::Index> > expected;
+                  for ( Subdivision::Index i = 0; i < points.size(); ++i )
+                    expected.push_back( std::make_pair
+                                        ( squaredDistance( points[ i ], queries[ j ] ), i ) );
+                  std::sort( expected.begin(), expected.end() );
+                  if ( result[ j ].size() != k ) { ++nbErrors; continue; }
+                  for ( std::size_t l = 0; l < k; ++l )
+                    if ( result[ j ][ l ] != expected[ l ].second ) ++nbErrors;
+                }
+              REQUIRE( nbErrors == 0 );
+            }
+        }
+    }
+
+  GIVEN( "Points pushed one by one" )
+    {
+      Subdivision T( lo, up, 4 );
+      for ( std::size_t i = 0; i < 500; ++i ) T.push( points[ i ] );
+      T.push( points.begin() + 500, points.end() );
+      THEN( "The subdivision is the same as the one built from the range" )
+        {
+          REQUIRE( T.isValid() );
+          REQUIRE( T.nbPoints() == points.size() );
+          Indices a, b;
+          S.getIndices( a, S.binDomain().lowerBound(), S.binDomain().upperBound() );
+          T.getIndices( b, T.binDomain().lowerBound(), T.binDomain().upperBound() );
+          REQUIRE( a == b );
+          std::vector<Point> pa, pb;
+          S.getPoints( pa, Point( 1, 1, 1 ), Point( 3, 4, 2 ) );
+          T.getPoints( pb, Point( 1, 1, 1 ), Point( 3, 4, 2 ) );
+          REQUIRE( pa == pb );
+        }
+      THEN( "Queries also see the points chained since the last rebuild" )
+        {
+          Subdivision V( lo, up, 4 );
+          for ( std::size_t i = 0; i < 1000; ++i ) V.push( points[ i ] );
+          REQUIRE( V.isValid() );
+          REQUIRE( V.nbPoints() == 1000 );
+          const double radius = 5.5;
+          auto balls = V.getIndicesInBalls( queries, radius );
+          auto knn   = V.getKNearestIndices( queries, 7 );
+          unsigned int nbErrors = 0;
+          for ( std::size_t j = 0; j < queries.size(); ++j )
+            {
+              Indices expected;
+              std::vector< std::pair<double,Subdivision::Index> > sorted;
+              for ( Subdivision::Index i = 0; i < 1000; ++i )
+                {
+                  const double d2 = squaredDistance( points[ i ], queries[ j ] );
+                  if ( d2 <= radius * radius ) expected.push_back( i );
+                  sorted.push_back( std::make_pair( d2, i ) );
+                }
+              std::sort( sorted.begin(), sorted.end() );
+              if ( balls[ j ] != expected ) ++nbErrors;
+              for ( std::size_t l = 0; l < 7; ++l )
+                if ( knn[ j ][ l ] != sorted[ l ].second ) ++nbErrors;
+            }
+          REQUIRE( nbErrors == 0 );
+        }
+      THEN( "Asking for more neighbors than points returns all the points" )
+        {
+          Subdivision U( lo, up, 4 );
+          U.push( points.begin(), points.begin() + 10 );
+          Indices knn;
+          U.getKNearestIndices( knn, Point( 100, 100, 100 ), 20 );
+          REQUIRE( knn.size() == 10 );
+        }
+    }
+}
+
+/** @ingroup Tests **/
@@ -101,6 +101,48 @@ bool testVoronoiCovarianceMeasure()
   trace.info() << "- vcm_r.row(0) = " << vcm_r.row( 0 ) << std::endl;
   trace.info() << "- vcm_r.row(1) = " << vcm_r.row( 1 ) << std::endl;
   trace.info() << "- vcm_r.row(2) = " << vcm_r.row( 2 ) << std::endl;
+
+  std::vector<Matrix> vcms_r = vcm.measures( chi_r, pts );
+  unsigned int nbdiff = 0;
+  for ( std::size_t i = 0; i < pts.size(); ++i )
+    nbdiff += vcms_r[ i ] == vcm.measure( chi_r, pts[ i ] ) ? 0 : 1;
+  nbok += ( vcms_r.size() == pts.size() && nbdiff == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "measures( chi_r, pts ) == measure( chi_r, p ) for each p" << std::endl;
+  nbok += vcm.vcmMap().size() == 9 ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "vcmMap().size() == 9" << std::endl;
+  nbdiff = 0;
+  std::size_t index = 0;
+  for ( VCM::Point2MatrixNN::const_iterator it = vcm.vcmMap().begin(),
+          itE = vcm.vcmMap().end(); it != itE; ++it, ++index )
+    nbdiff += ( it->first == vcm.sites()[ index ]
+                && it->second == vcm.vcmMatrices()[ index ] ) ? 0 : 1;
+  nbok += ( index == vcm.sites().size() && nbdiff == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "vcmMap() iterates over sites() and vcmMatrices()" << std::endl;
+
+  // Sweeping the whole domain gives the matrices computed on the narrow band.
+  std::vector<Matrix> full( vcm.sites().size() );
+  for ( Domain::ConstIterator it = d.begin(), itE = d.end(); it != itE; ++it )
+    {
+      Point q = vcm.voronoiMap()( *it );
+      if ( q == *it || l2( q, *it ) > vcm.R() ) continue;
+      Point v = *it - q;
+      Matrix m;
+      for ( Dimension i = 0; i < 3; ++i )
+        for ( Dimension j = 0; j < 3; ++j )
+          m.setComponent( i, j, v[ i ] * v[ j ] );
+      full[ vcm.siteIndex( q ) ] += m;
+    }
+  nbok += ( vcm.vcmMatrices().size() == 9 && full == vcm.vcmMatrices()
+            && vcm.siteIndex( Point( 0, 0, 0 ) ) == 9 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "vcmMatrices() == matrices over the whole domain" << std::endl;
   trace.endBlock();
   
   return nbok == nb;
@@ -29,6 +29,7 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 
 #include "DGtal/io/boards/Board2D.h"
@@ -273,6 +274,67 @@ bool testBadKeySizes()
   return true;  
 }
 
+/**
+ * Bulk build from a dense image and batched reads.
+ */
+bool testBuildAndGetValues()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef experimental::ImageContainerByHashTree<Z2i::Domain, int> Image;
+  typedef ImageContainerBySTLVector<Z2i::Domain, int> ImageVector;
+
+  trace.beginBlock ( "Build from a dense image" );
+  const Z2i::Domain domain( Z2i::Point( 0, 0 ), Z2i::Point( 99, 80 ) );
+  ImageVector dense( domain );
+  for ( auto p : domain )
+    dense.setValue( p, ( p[0] / 16 + p[1] / 8 ) % 3 + ( p[0] == 37 && p[1] == 41 ? 7 : 0 ) );
+
+  Image tree( 3, 7, 0 );
+  tree.setValue( Z2i::Point( 120, 3 ), 5 );
+  tree.buildFromImage( dense, 2 );
+  bool result = true;
+  for ( auto p : domain )
+    result = result && ( tree( p ) == dense( p ) );
+  result = result && ( tree( Z2i::Point( 120, 3 ) ) == 2 ) && ( tree( Z2i::Point( 127, 127 ) ) == 2 );
+  nbok += result ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") values of the dense image" << std::endl;
+  nbok += ( tree.getNbNodes() < domain.size() / 8 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << tree.getNbNodes()
+               << " nodes for " << domain.size() << " points" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Batched get" );
+  std::vector<Z2i::Point> points;
+  for ( int i = 0; i < 5000; ++i )
+    points.push_back( Z2i::Point( ( i * 37 ) % 128, ( i * 91 + i / 7 ) % 128 ) );
+  std::vector<int> values;
+  tree.getValues( points.begin(), points.end(), std::back_inserter( values ) );
+  result = values.size() == points.size();
+  for ( std::size_t i = 0; result && i < points.size(); ++i )
+    result = values[ i ] == tree( points[ i ] );
+  nbok += result ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") getValues == operator()" << std::endl;
+
+  // Removing nodes keeps the others reachable.
+  for ( auto p : Z2i::Domain( Z2i::Point( 32, 32 ), Z2i::Point( 63, 63 ) ) )
+    tree.setValue( p, 9 );
+  result = true;
+  for ( auto p : domain )
+    result = result && ( tree( p ) == ( Z2i::Domain( Z2i::Point( 32, 32 ), Z2i::Point( 63, 63 ) ).isInside( p )
+                                        ? 9 : dense( p ) ) );
+  nbok += result ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") values after setValue" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -284,7 +346,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << std::endl;
 
-  bool res = testHashTree() && testHashTree2D() && testGetSetVal() && testBadKeySizes();  // && ... other tests
+  bool res = testHashTree() && testHashTree2D() && testGetSetVal() && testBadKeySizes()
+    && testBuildAndGetValues();  // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << std::endl;
   trace.endBlock();
   return res ? 0 : 1;
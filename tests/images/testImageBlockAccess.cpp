@@ -0,0 +1,297 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing the row and block accesses of ImageBlockAccess.h.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ArrayImageAdapter.h"
+#include "DGtal/images/ImageFactoryFromImage.h"
+#include "DGtal/images/TiledImage.h"
+#include "DGtal/images/ConstImageAdapter.h"
+#include "DGtal/images/ImageAdapter.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/images/ImageBlockAccess.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing ImageBlockAccess.h.
+///////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+  /// Checks the block functions on an image of domain [-3,12]x[2,10]x[0,4].
+  template <typename TImage>
+  void checkBlocks( TImage & image )
+  {
+    const Z3i::Domain domain = image.domain();
+    int i = 0;
+    for ( auto p : domain ) image.setValue( p, i++ );
+
+    const Z3i::Domain block( Z3i::Point( -1, 4, 1 ), Z3i::Point( 9, 7, 3 ) );
+    std::vector<int> values( block.size() );
+    getBlock( image, block, values.data() );
+    std::size_t k = 0;
+    unsigned int nbDifferences = 0;
+    for ( auto p : block )
+      if ( values[ k++ ] != image( p ) ) ++nbDifferences;
+    REQUIRE( nbDifferences == 0 );
+
+    for ( k = 0; k < values.size(); ++k ) values[ k ] = - (int) k;
+    setBlock( image, block, values.data() );
+    fillBlock( image, Z3i::Domain( Z3i::Point( 10, 2, 0 ), Z3i::Point( 12, 10, 0 ) ), 1000 );
+    fillBlock( image, Z3i::Domain( Z3i::Point( 1, 1, 1 ), Z3i::Point( 0, 0, 0 ) ), 2000 );
+    i = 0;
+    for ( auto p : domain )
+      {
+        int expected = i++;
+        if ( block.isInside( p ) )
+          expected = - (int) ( ( p[ 0 ] - block.lowerBound()[ 0 ] )
+                               + 11 * ( ( p[ 1 ] - block.lowerBound()[ 1 ] )
+                                        + 4 * ( p[ 2 ] - block.lowerBound()[ 2 ] ) ) );
+        if ( p[ 0 ] >= 10 && p[ 2 ] == 0 ) expected = 1000;
+        if ( image( p ) != expected ) ++nbDifferences;
+      }
+    REQUIRE( nbDifferences == 0 );
+
+    int row[ 5 ];
+    getRow( image, Z3i::Point( 8, 5, 2 ), 5, row );
+    REQUIRE( row[ 0 ] == image( Z3i::Point( 8, 5, 2 ) ) );
+    REQUIRE( row[ 4 ] == image( Z3i::Point( 12, 5, 2 ) ) );
+    const int ones[ 3 ] = { 1, 1, 1 };
+    setRow( image, Z3i::Point( -3, 10, 4 ), 3, ones );
+    fillRow( image, Z3i::Point( 0, 10, 4 ), 2, 7 );
+    REQUIRE( image( Z3i::Point( -1, 10, 4 ) ) == 1 );
+    REQUIRE( image( Z3i::Point( 1, 10, 4 ) ) == 7 );
+    REQUIRE( image( Z3i::Point( 2, 10, 4 ) ) != 7 );
+  }
+
+  /// Value functor of the image adapters: an affine rescaling.
+  struct Rescale
+  {
+    double operator()( int v ) const
+    {
+      return 0.5 * v - 3.0;
+    }
+  };
+
+  /// Inverse of Rescale.
+  struct InverseRescale
+  {
+    int operator()( double v ) const
+    {
+      return (int) ( 2.0 * ( v + 3.0 ) );
+    }
+  };
+}
+
+TEST_CASE( "Testing rowSpan" )
+{
+  typedef ImageContainerBySTLVector<Z2i::Domain, int> Image;
+  Image image( Z2i::Domain( Z2i::Point( -2, 1 ), Z2i::Point( 5, 4 ) ) );
+  int i = 0;
+  for ( auto p : image.domain() ) image.setValue( p, i++ );
+
+  ImageRowSpan<Image::Iterator> span = image.rowSpan( Z2i::Point( 1, 3 ) );
+  REQUIRE( span.size() == 5 );
+  REQUIRE( span[ 0 ] == image( Z2i::Point( 1, 3 ) ) );
+  REQUIRE( span[ 4 ] == image( Z2i::Point( 5, 3 ) ) );
+  span[ 1 ] = -1;
+  REQUIRE( image( Z2i::Point( 2, 3 ) ) == -1 );
+
+  std::vector<int> storage( 100 );
+  for ( std::size_t k = 0; k < storage.size(); ++k ) storage[ k ] = (int) k;
+  const Z2i::Domain full( Z2i::Point( 0, 0 ), Z2i::Point( 9, 9 ) );
+  auto view = makeArrayImageAdapterFromIterator( storage.data(), full,
+                                                 Z2i::Domain( Z2i::Point( 2, 3 ), Z2i::Point( 6, 8 ) ) );
+  auto viewSpan = view.rowSpan( Z2i::Point( 4, 5 ) );
+  REQUIRE( viewSpan.size() == 3 );
+  REQUIRE( std::vector<int>( viewSpan.begin(), viewSpan.end() ) == std::vector<int>( { 54, 55, 56 } ) );
+}
+
+TEST_CASE( "Testing block accesses" )
+{
+  const Z3i::Domain domain( Z3i::Point( -3, 2, 0 ), Z3i::Point( 12, 10, 4 ) );
+
+  SECTION( "ImageContainerBySTLVector" )
+    {
+      ImageContainerBySTLVector<Z3i::Domain, int> image( domain );
+      checkBlocks( image );
+    }
+
+  SECTION( "ImageContainerBySTLMap (point by point)" )
+    {
+      ImageContainerBySTLMap<Z3i::Domain, int> image( domain );
+      checkBlocks( image );
+    }
+
+  SECTION( "ArrayImageAdapter" )
+    {
+      const Z3i::Domain full( domain.lowerBound() - Z3i::Vector::diagonal( 2 ),
+                              domain.upperBound() + Z3i::Vector::diagonal( 1 ) );
+      std::vector<int> storage( full.size(), -5 );
+      auto image = makeArrayImageAdapterFromIterator( storage.begin(), full, domain );
+      checkBlocks( image );
+      REQUIRE( storage.front() == -5 );
+      REQUIRE( storage.back() == -5 );
+    }
+
+  SECTION( "TiledImage with the write-through policy" )
+    {
+      typedef ImageContainerBySTLVector<Z3i::Domain, int> Image;
+      typedef ImageFactoryFromImage<Image> Factory;
+      typedef Factory::OutputImage OutputImage;
+      typedef ImageCacheReadPolicyFIFO<OutputImage, Factory> ReadPolicy;
+      typedef ImageCacheWritePolicyWT<OutputImage, Factory> WritePolicy;
+      typedef TiledImage<Image, Factory, ReadPolicy, WritePolicy> Tiled;
+
+      Image source( domain );
+      Factory factory( source );
+      ReadPolicy readPolicy( factory, 2 );
+      WritePolicy writePolicy( factory );
+      Tiled tiled( factory, readPolicy, writePolicy, 3 );
+      checkBlocks( tiled );
+
+      // The written tiles were flushed in the source image.
+      unsigned int nbDifferences = 0;
+      for ( auto p : domain )
+        if ( source( p ) != tiled( p ) ) ++nbDifferences;
+      REQUIRE( nbDifferences == 0 );
+    }
+}
+
+TEST_CASE( "Testing setFromImage by rows" )
+{
+  typedef ImageContainerBySTLVector<Z2i::Domain, int> Image;
+  typedef ImageContainerBySTLMap<Z2i::Domain, int> MapImage;
+  const Z2i::Domain domain( Z2i::Point( -4, -3 ), Z2i::Point( 7, 5 ) );
+  Image image( domain );
+  MapImage mapImage( domain );
+  for ( auto p : domain )
+    {
+      image.setValue( p, p[ 0 ] * p[ 1 ] );
+      mapImage.setValue( p, p[ 0 ] * p[ 1 ] );
+    }
+
+  std::vector<Z2i::Point> below, mapBelow, between, mapBetween;
+  setFromImage( image, std::back_inserter( below ), 2 );
+  setFromImage( mapImage, std::back_inserter( mapBelow ), 2 );
+  setFromImage( image, std::back_inserter( between ), -3, 4 );
+  setFromImage( mapImage, std::back_inserter( mapBetween ), -3, 4 );
+  REQUIRE( ! below.empty() );
+  REQUIRE( below == mapBelow );
+  REQUIRE( ! between.empty() );
+  REQUIRE( between == mapBetween );
+}
+
+TEST_CASE( "Testing image adapters by rows" )
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> Image;
+  typedef ConstImageAdapter<Image, Z3i::Domain, functors::Identity, double, Rescale> Rescaled;
+  typedef functors::Thresholder<double, false, false> Threshold;
+  typedef ConstImageAdapter<Rescaled, Z3i::Domain, functors::Identity, bool, Threshold> Thresholded;
+  typedef ImageAdapter<Image, Z3i::Domain, functors::Identity, double, Rescale, InverseRescale> Writable;
+
+  const Z3i::Domain domain( Z3i::Point( -3, 2, 0 ), Z3i::Point( 300, 10, 4 ) );
+  const Z3i::Domain larger( Z3i::Point( -5, 1, 0 ), Z3i::Point( 302, 10, 5 ) );
+  Image image( domain );
+  for ( auto p : domain ) image.setValue( p, ( p[ 0 ] * 7 + p[ 1 ] * 3 - p[ 2 ] ) % 23 );
+  const functors::Identity id;
+  const Rescale rescale;
+  const Threshold threshold( 2.0 );
+
+  SECTION( "Rows inside and outside of the adapted domain" )
+    {
+      Rescaled rescaled( image, larger, id, rescale );
+      rescaled.setDefaultValue( -100.0 );
+      std::vector<double> values( larger.upperBound()[ 0 ] - larger.lowerBound()[ 0 ] + 1 );
+      unsigned int nbDifferences = 0;
+      for ( auto row : detail::rowStarts( larger ) )
+        {
+          rescaled.getRow( row, values.size(), values.data() );
+          Z3i::Point p = row;
+          for ( std::size_t k = 0; k < values.size(); ++k, ++p[ 0 ] )
+            if ( values[ k ] != rescaled( p ) ) ++nbDifferences;
+        }
+      REQUIRE( nbDifferences == 0 );
+      REQUIRE( values.front() == -100.0 );
+    }
+
+  SECTION( "A chain of adapters materialized with imageFromImage" )
+    {
+      Rescaled rescaled( image, domain, id, rescale );
+      Thresholded thresholded( rescaled, domain, id, threshold );
+      REQUIRE( detail::IsRowAccessible<Thresholded>::value );
+      ImageContainerBySTLVector<Z3i::Domain, bool> result( domain );
+      ImageContainerBySTLMap<Z3i::Domain, bool> mapResult( domain );
+      imageFromImage( result, thresholded );
+      imageFromImage( mapResult, thresholded );
+      unsigned int nbDifferences = 0, nbTrue = 0;
+      for ( auto p : domain )
+        {
+          const bool expected = 0.5 * image( p ) - 3.0 > 2.0;
+          if ( result( p ) != expected || mapResult( p ) != expected ) ++nbDifferences;
+          if ( expected ) ++nbTrue;
+        }
+      REQUIRE( nbDifferences == 0 );
+      REQUIRE( nbTrue > 0 );
+      REQUIRE( nbTrue < domain.size() );
+
+      ImageContainerBySTLVector<Z3i::Domain, double> rescaledCopy( domain );
+      imageFromImage( rescaledCopy, rescaled );
+      for ( auto p : domain )
+        if ( rescaledCopy( p ) != 0.5 * image( p ) - 3.0 ) ++nbDifferences;
+      REQUIRE( nbDifferences == 0 );
+    }
+
+  SECTION( "Writing through an ImageAdapter" )
+    {
+      const InverseRescale inverse;
+      Writable writable( image, domain, id, rescale, inverse );
+      const Z3i::Domain block( Z3i::Point( 0, 3, 1 ), Z3i::Point( 280, 5, 2 ) );
+      fillBlock( writable, block, 5.0 );
+      std::vector<double> values( block.size(), 0.0 );
+      getBlock( writable, block, values.data() );
+      unsigned int nbDifferences = 0;
+      for ( std::size_t k = 0; k < values.size(); ++k )
+        if ( values[ k ] != 5.0 ) ++nbDifferences;
+      for ( auto p : block )
+        if ( image( p ) != 16 ) ++nbDifferences;
+      REQUIRE( nbDifferences == 0 );
+    }
+}
+
+/** @ingroup Tests **/
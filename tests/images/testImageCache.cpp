@@ -290,6 +290,120 @@ bool testSimple()
     return nbok == nb;
 }
 
+bool testReplacementPolicies()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing LRU, ARC and sharded LRU read policies");
+
+    typedef ImageContainerBySTLVector<Z2i::Domain, int> VImage;
+
+    VImage image(Z2i::Domain(Z2i::Point(0,0), Z2i::Point(7,7)));
+    int i = 1;
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+        *it = i++;
+
+    typedef ImageFactoryFromImage<VImage > MyImageFactoryFromImage;
+    MyImageFactoryFromImage factImage(image);
+    typedef MyImageFactoryFromImage::OutputImage OutputImage;
+    typedef ImageCacheWritePolicyWB<OutputImage, MyImageFactoryFromImage> MyImageCacheWritePolicyWB;
+    MyImageCacheWritePolicyWB imageCacheWritePolicyWB(factImage);
+
+    // 4x4 tiles of 2x2 ints, 3 tiles in the budget.
+    const std::size_t budget = 3 * 4 * sizeof(int);
+    std::vector<Z2i::Domain> tiles;
+    for (int y = 0; y < 8; y += 2)
+      for (int x = 0; x < 8; x += 2)
+        tiles.push_back(Z2i::Domain(Z2i::Point(x,y), Z2i::Point(x+1,y+1)));
+    OutputImage::Value aValue;
+
+    // 1) LRU
+    typedef ImageCacheReadPolicyLRU<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyLRU;
+    MyImageCacheReadPolicyLRU imageCacheReadPolicyLRU(factImage, budget, 4);
+    typedef ImageCache<OutputImage, MyImageFactoryFromImage, MyImageCacheReadPolicyLRU, MyImageCacheWritePolicyWB > MyImageCacheLRU;
+    MyImageCacheLRU imageCacheLRU(factImage, imageCacheReadPolicyLRU, imageCacheWritePolicyWB);
+
+    imageCacheLRU.update(tiles[0]);
+    imageCacheLRU.update(tiles[1]);
+    imageCacheLRU.update(tiles[2]);
+    imageCacheLRU.write(Z2i::Point(2,1), 100); // in tiles[1]
+    imageCacheLRU.read(Z2i::Point(0,0), aValue);
+    imageCacheLRU.read(Z2i::Point(4,0), aValue); // tiles[1] is now the least recently used one
+    imageCacheLRU.update(tiles[3]);
+    trace.info() << "LRU: " << imageCacheReadPolicyLRU.nbPages() << " pages, "
+                 << imageCacheReadPolicyLRU.nbBytes() << " bytes, "
+                 << imageCacheReadPolicyLRU.nbEvictions() << " evictions" << endl;
+    nbok += ( (imageCacheReadPolicyLRU.nbPages() == 3) && (imageCacheReadPolicyLRU.nbBytes() == budget)
+              && (imageCacheReadPolicyLRU.nbEvictions() == 1) ) ? 1 : 0;
+    nb++;
+    nbok += ( (imageCacheLRU.getPage(tiles[1]) == NULL) && (imageCacheLRU.getPage(tiles[0]) != NULL)
+              && imageCacheLRU.read(Z2i::Point(7,0), aValue) && (aValue == 8) ) ? 1 : 0;
+    nb++;
+    // The replaced page has been flushed.
+    nbok += (image(Z2i::Point(2,1)) == 100) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    // 2) ARC: pages accessed twice are kept while scanning other pages.
+    typedef ImageCacheReadPolicyARC<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyARC;
+    MyImageCacheReadPolicyARC imageCacheReadPolicyARC(factImage, budget, 4);
+    typedef ImageCache<OutputImage, MyImageFactoryFromImage, MyImageCacheReadPolicyARC, MyImageCacheWritePolicyWB > MyImageCacheARC;
+    MyImageCacheARC imageCacheARC(factImage, imageCacheReadPolicyARC, imageCacheWritePolicyWB);
+
+    imageCacheARC.update(tiles[0]);
+    imageCacheARC.update(tiles[1]);
+    imageCacheARC.read(Z2i::Point(0,0), aValue);
+    imageCacheARC.read(Z2i::Point(2,0), aValue);
+    for (unsigned int t = 2; t < tiles.size(); t++)
+      if (!imageCacheARC.read(tiles[t].lowerBound(), aValue))
+        imageCacheARC.update(tiles[t]);
+    trace.info() << "ARC: " << imageCacheReadPolicyARC.nbPages() << " pages, "
+                 << imageCacheReadPolicyARC.nbHits() << " hits, "
+                 << imageCacheReadPolicyARC.nbMisses() << " misses, "
+                 << imageCacheReadPolicyARC.nbEvictions() << " evictions" << endl;
+    nbok += ( (imageCacheReadPolicyARC.nbPages() == 3) && (imageCacheReadPolicyARC.nbBytes() <= budget)
+              && (imageCacheARC.getPage(tiles[0]) != NULL) && (imageCacheARC.getPage(tiles[1]) != NULL)
+              && (imageCacheARC.getPage(tiles[15]) != NULL) ) ? 1 : 0;
+    nb++;
+    nbok += ( imageCacheARC.read(Z2i::Point(7,7), aValue) && (aValue == 64) ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    // 3) Sharded LRU
+    typedef ImageCacheWritePolicyWT<OutputImage, MyImageFactoryFromImage> MyImageCacheWritePolicyWT;
+    MyImageCacheWritePolicyWT imageCacheWritePolicyWT(factImage);
+    typedef ImageCacheReadPolicyShardedLRU<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyShardedLRU;
+    MyImageCacheReadPolicyShardedLRU imageCacheReadPolicyShardedLRU(factImage, 4 * budget, 4, 4);
+    typedef ImageCache<OutputImage, MyImageFactoryFromImage, MyImageCacheReadPolicyShardedLRU, MyImageCacheWritePolicyWT > MyImageCacheSharded;
+    MyImageCacheSharded imageCacheSharded(factImage, imageCacheReadPolicyShardedLRU, imageCacheWritePolicyWT);
+
+    unsigned int nbErrors = 0;
+    for (unsigned int t = 0; t < tiles.size(); t++)
+      for (Z2i::Domain::ConstIterator it = tiles[t].begin(); it != tiles[t].end(); ++it)
+      {
+        if (!imageCacheSharded.read(*it, aValue))
+        {
+          imageCacheSharded.update(tiles[t]);
+          imageCacheSharded.read(*it, aValue);
+        }
+        if (aValue != image(*it)) nbErrors++;
+      }
+    trace.info() << "Sharded LRU: " << imageCacheReadPolicyShardedLRU.nbPages() << " pages, "
+                 << imageCacheReadPolicyShardedLRU.nbBytes() << " bytes, "
+                 << imageCacheReadPolicyShardedLRU.nbEvictions() << " evictions" << endl;
+    nbok += ( (nbErrors == 0) && (imageCacheReadPolicyShardedLRU.nbBytes() <= 4 * budget)
+              && (imageCacheReadPolicyShardedLRU.nbMisses() == tiles.size()) ) ? 1 : 0;
+    nb++;
+    nbok += ( imageCacheSharded.write(Z2i::Point(7,7), 200) && (image(Z2i::Point(7,7)) == 200) ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -301,7 +415,7 @@ int main( int argc, char** argv )
         trace.info() << " " << argv[ i ];
     trace.info() << endl;
 
-    bool res = testSimple(); // && ... other tests
+    bool res = testSimple() && testReplacementPolicies(); // && ... other tests
 
     trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
     trace.endBlock();
@@ -0,0 +1,182 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class ImageContainerByMappedFile.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#include <fstream>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByMappedFile.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/readers/LongvolReader.h"
+#include "DGtal/io/writers/VolWriter.h"
+#include "DGtal/io/writers/LongvolWriter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerByMappedFile.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing ImageContainerByMappedFile" )
+{
+  typedef ImageContainerByMappedFile<Z3i::Domain, unsigned char> MappedImage;
+  typedef ImageContainerByMappedFile<Z3i::Domain, DGtal::uint64_t> MappedLongImage;
+  typedef ImageContainerByMappedFile<Z2i::Domain, int> MappedRawImage;
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< MappedImage > ));
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< MappedRawImage > ));
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+  typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint64_t> LongImage;
+
+  SECTION( "Mapping a vol file gives the image read by VolReader" )
+    {
+      // The samples are compressed: they are written back uncompressed.
+      Image image = VolReader<Image>::importVol( testPath + "samples/lobsterCroped.vol" );
+      VolWriter<Image>::exportVol( "testImageContainerByMappedFile.vol", image, false );
+      MappedImage mapped = MappedImage::importVol( "testImageContainerByMappedFile.vol" );
+      REQUIRE( mapped.isValid() );
+      REQUIRE( mapped.domain().lowerBound() == image.domain().lowerBound() );
+      REQUIRE( mapped.domain().upperBound() == image.domain().upperBound() );
+      REQUIRE( std::equal( image.constRange().begin(), image.constRange().end(),
+                           mapped.constRange().begin() ) );
+      unsigned int nbDifferences = 0;
+      for ( auto p : image.domain() )
+        if ( image( p ) != mapped( p ) ) ++nbDifferences;
+      REQUIRE( nbDifferences == 0 );
+    }
+
+  SECTION( "Mapping a centered vol file and a longvol file" )
+    {
+      Z3i::Domain domain( Z3i::Point( -5, -2, 3 ), Z3i::Point( 9, 6, 11 ) );
+      Image image( domain );
+      LongImage longImage( domain );
+      unsigned int i = 0;
+      for ( auto p : domain )
+        {
+          image.setValue( p, (unsigned char) ( ( 13 * i ) % 256 ) );
+          longImage.setValue( p, ( DGtal::uint64_t( i ) << 33 ) + i );
+          ++i;
+        }
+      VolWriter<Image>::exportVol( "testImageContainerByMappedFile.vol", image, false );
+      LongvolWriter<LongImage>::exportLongvol( "testImageContainerByMappedFile.longvol",
+                                               longImage, false );
+
+      MappedImage mapped = MappedImage::importVol( "testImageContainerByMappedFile.vol" );
+      MappedLongImage mappedLong =
+        MappedLongImage::importLongvol( "testImageContainerByMappedFile.longvol" );
+      Image expected = VolReader<Image>::importVol( "testImageContainerByMappedFile.vol" );
+      REQUIRE( mapped.domain().lowerBound() == expected.domain().lowerBound() );
+      REQUIRE( mappedLong.domain().lowerBound() == expected.domain().lowerBound() );
+      unsigned int nbDifferences = 0;
+      Z3i::Point shift = expected.domain().lowerBound() - domain.lowerBound();
+      for ( auto p : domain )
+        {
+          if ( mapped( p + shift ) != image( p ) ) ++nbDifferences;
+          if ( mappedLong( p + shift ) != longImage( p ) ) ++nbDifferences;
+        }
+      REQUIRE( nbDifferences == 0 );
+
+      VolWriter<Image>::exportVol( "testImageContainerByMappedFile.vol", image, true );
+      REQUIRE_THROWS_AS( MappedImage::importVol( "testImageContainerByMappedFile.vol" ),
+                         IOException );
+    }
+
+  SECTION( "Raw files, read-only and copy-on-write mappings" )
+    {
+      Z2i::Domain domain( Z2i::Point( 0, 0 ), Z2i::Point( 15, 9 ) );
+      std::vector<int> values( domain.size() + 3 );
+      for ( std::size_t i = 0; i < values.size(); ++i )
+        values[ i ] = (int) ( i * i ) - 100;
+      {
+        std::ofstream out( "testImageContainerByMappedFile.raw", std::ios::binary );
+        out.write( "header", 6 );
+        out.write( reinterpret_cast<const char*>( values.data() ),
+                   values.size() * sizeof( int ) );
+      }
+
+      MappedRawImage image( "testImageContainerByMappedFile.raw", domain, 6 );
+      REQUIRE( image.mode() == MappedRawImage::READ_ONLY );
+      REQUIRE( image( Z2i::Point( 0, 0 ) ) == values[ 0 ] );
+      REQUIRE( image( Z2i::Point( 3, 2 ) ) == values[ 3 + 2 * 16 ] );
+      REQUIRE( image( Z2i::Point( 15, 9 ) ) == values[ domain.size() - 1 ] );
+      REQUIRE_THROWS_AS( image.setValue( Z2i::Point( 1, 1 ), 7 ), IOException );
+
+      MappedRawImage cow( "testImageContainerByMappedFile.raw", domain, 6,
+                          MappedRawImage::COPY_ON_WRITE );
+      cow.setValue( Z2i::Point( 1, 1 ), 7 );
+      REQUIRE( cow( Z2i::Point( 1, 1 ) ) == 7 );
+      MappedRawImage copy( cow );
+      REQUIRE( copy( Z2i::Point( 1, 1 ) ) == 7 );
+      // Copy-on-write copies are independent.
+      copy.setValue( Z2i::Point( 2, 1 ), 8 );
+      cow.setValue( Z2i::Point( 1, 1 ), 9 );
+      REQUIRE( copy( Z2i::Point( 1, 1 ) ) == 7 );
+      REQUIRE( cow( Z2i::Point( 2, 1 ) ) == values[ 18 ] );
+      MappedRawImage assigned( image );
+      assigned = cow;
+      REQUIRE( assigned.mode() == MappedRawImage::COPY_ON_WRITE );
+      assigned.setValue( Z2i::Point( 3, 1 ), 10 );
+      REQUIRE( assigned( Z2i::Point( 1, 1 ) ) == 9 );
+      REQUIRE( cow( Z2i::Point( 3, 1 ) ) == values[ 19 ] );
+      // The file is not modified.
+      MappedRawImage reread( "testImageContainerByMappedFile.raw", domain, 6 );
+      REQUIRE( reread( Z2i::Point( 1, 1 ) ) == values[ 17 ] );
+
+      // A moved-from image has no mapping, but can still be copied,
+      // displayed and assigned.
+      MappedRawImage moved( std::move( assigned ) );
+      REQUIRE( moved( Z2i::Point( 3, 1 ) ) == 10 );
+      REQUIRE( ! assigned.isValid() );
+      REQUIRE( assigned.mode() == MappedRawImage::READ_ONLY );
+      std::ostringstream display;
+      display << assigned;
+      REQUIRE( display.str().find( "mode=none" ) != std::string::npos );
+      MappedRawImage copyOfMoved( assigned );
+      REQUIRE( ! copyOfMoved.isValid() );
+      REQUIRE_THROWS_AS( assigned.setValue( Z2i::Point( 1, 1 ), 7 ), IOException );
+      assigned = moved;
+      REQUIRE( assigned.isValid() );
+      REQUIRE( assigned( Z2i::Point( 3, 1 ) ) == 10 );
+
+      Z2i::Domain tooLarge( Z2i::Point( 0, 0 ), Z2i::Point( 15, 10 ) );
+      REQUIRE_THROWS_AS( MappedRawImage( "testImageContainerByMappedFile.raw", tooLarge, 6 ),
+                         IOException );
+      REQUIRE_THROWS_AS( MappedRawImage( "testImageContainerByMappedFile-missing.raw", domain ),
+                         IOException );
+    }
+}
+
+/** @ingroup Tests **/
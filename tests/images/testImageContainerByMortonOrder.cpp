@@ -0,0 +1,139 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing classes ImageContainerByMortonOrder and
+ * ImageNeighbourhood.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <set>
+#include "DGtal/base/Common.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByMortonOrder.h"
+#include "DGtal/images/ImageNeighbourhood.h"
+#include "DGtal/images/ImageHelper.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing classes ImageContainerByMortonOrder and ImageNeighbourhood.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing ImageContainerByMortonOrder" )
+{
+  typedef ImageContainerByMortonOrder<Z3i::Domain, int> Image;
+  BOOST_CONCEPT_ASSERT(( concepts::CImage<Image> ));
+
+  const Z3i::Domain domain( Z3i::Point( -3, 2, 1 ), Z3i::Point( 10, 7, 9 ) );
+  Image image( domain, -1 );
+  REQUIRE( image.isValid() );
+  REQUIRE( image.container().size() == 16 * 8 * 12 );
+
+  SECTION( "Indices are distinct and values are stored by bricks" )
+    {
+      std::set<Image::Size> indices;
+      for ( auto p : domain )
+        indices.insert( image.linearized( p ) );
+      REQUIRE( indices.size() == domain.size() );
+      REQUIRE( *indices.rbegin() < image.container().size() );
+
+      // The 2x2x2 cube at the origin of a brick is contiguous.
+      const Z3i::Point origin( 1, 2, 1 );
+      const Image::Size first = image.linearized( origin );
+      for ( auto p : Z3i::Domain( origin, origin + Z3i::Vector::diagonal( 1 ) ) )
+        REQUIRE( image.linearized( p ) - first < 8 );
+    }
+
+  SECTION( "Values" )
+    {
+      int i = 0;
+      for ( auto p : domain ) image.setValue( p, i++ );
+      i = 0;
+      unsigned int nbDifferences = 0;
+      for ( auto p : domain )
+        if ( image( p ) != i++ ) ++nbDifferences;
+      REQUIRE( nbDifferences == 0 );
+      REQUIRE( image[ image.linearized( Z3i::Point( 4, 5, 6 ) ) ] == image( Z3i::Point( 4, 5, 6 ) ) );
+
+      ImageContainerBySTLVector<Z3i::Domain, int> copy( domain );
+      imageFromImage( copy, image );
+      for ( auto p : domain )
+        if ( copy( p ) != image( p ) ) ++nbDifferences;
+      REQUIRE( nbDifferences == 0 );
+    }
+}
+
+TEST_CASE( "Testing ImageNeighbourhood" )
+{
+  typedef ImageContainerByMortonOrder<Z3i::Domain, int> Image;
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> VectorImage;
+  typedef ImageNeighbourhood<Image> Neighbourhood;
+  typedef ImageNeighbourhood<VectorImage> VectorNeighbourhood;
+
+  REQUIRE( Neighbourhood::l1Neighbours().size() == 6 );
+  REQUIRE( Neighbourhood::lInfNeighbours().size() == 26 );
+
+  const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 6, 5, 9 ) );
+  Image image( domain );
+  VectorImage vectorImage( domain );
+  for ( auto p : domain )
+    {
+      image.setValue( p, p[ 0 ] + 10 * p[ 1 ] + 100 * p[ 2 ] );
+      vectorImage.setValue( p, p[ 0 ] + 10 * p[ 1 ] + 100 * p[ 2 ] );
+    }
+  Neighbourhood neighbourhood( image, Neighbourhood::lInfNeighbours() );
+  VectorNeighbourhood vectorNeighbourhood( vectorImage, VectorNeighbourhood::lInfNeighbours() );
+
+  REQUIRE( neighbourhood.isInterior( Z3i::Point( 1, 1, 1 ) ) );
+  REQUIRE( ! neighbourhood.isInterior( Z3i::Point( 0, 3, 3 ) ) );
+
+  unsigned int nbDifferences = 0;
+  std::size_t nbCorner = 0, nbInterior = 0;
+  for ( auto p : domain )
+    {
+      std::vector<int> values, vectorValues;
+      for ( auto it = neighbourhood.begin( p ), itE = neighbourhood.end( p ); it != itE; ++it )
+        {
+          if ( *it != image( it.point() ) || ! domain.isInside( it.point() ) ) ++nbDifferences;
+          values.push_back( *it );
+        }
+      for ( auto it = vectorNeighbourhood.begin( p ), itE = vectorNeighbourhood.end( p ); it != itE; ++it )
+        vectorValues.push_back( *it );
+      if ( values != vectorValues ) ++nbDifferences;
+      if ( p == Z3i::Point( 0, 0, 0 ) ) nbCorner = values.size();
+      if ( p == Z3i::Point( 3, 3, 3 ) ) nbInterior = values.size();
+    }
+  REQUIRE( nbDifferences == 0 );
+  REQUIRE( nbCorner == 7 );
+  REQUIRE( nbInterior == 26 );
+}
+
+/** @ingroup Tests **/
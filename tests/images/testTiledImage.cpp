@@ -29,11 +29,14 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <algorithm>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/images/ImageFactoryFromImage.h"
+#include "DGtal/images/AsyncImageFactory.h"
 #include "DGtal/images/TiledImage.h"
 
 #include "ConfigTest.h"
@@ -327,6 +330,159 @@ bool test_range_constRange()
     return nbok == nb;
 }
 
+bool testConcurrentReads()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing concurrent reads of a TiledImage");
+
+    typedef ImageContainerBySTLVector<Z3i::Domain, int> VImage;
+    VImage image(Z3i::Domain(Z3i::Point(0,0,0), Z3i::Point(31,31,31)));
+
+    int i = 1;
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+        *it = i++;
+
+    typedef ImageFactoryFromImage<VImage> MyImageFactoryFromImage;
+    typedef MyImageFactoryFromImage::OutputImage OutputImage;
+    MyImageFactoryFromImage imageFactoryFromImage(image);
+
+    // A quarter of the image in the cache.
+    typedef ImageCacheReadPolicyShardedLRU<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyShardedLRU;
+    typedef ImageCacheWritePolicyWT<OutputImage, MyImageFactoryFromImage> MyImageCacheWritePolicyWT;
+    MyImageCacheReadPolicyShardedLRU imageCacheReadPolicy(imageFactoryFromImage, image.domain().size() * sizeof(int) / 4, 8, 8);
+    MyImageCacheWritePolicyWT imageCacheWritePolicyWT(imageFactoryFromImage);
+
+    typedef TiledImage<VImage, MyImageFactoryFromImage, MyImageCacheReadPolicyShardedLRU, MyImageCacheWritePolicyWT> MyTiledImage;
+    BOOST_CONCEPT_ASSERT(( concepts::CImage< MyTiledImage > ));
+    MyTiledImage tiledImage(imageFactoryFromImage, imageCacheReadPolicy, imageCacheWritePolicyWT, 8);
+
+    std::vector<Z3i::Point> points(image.domain().begin(), image.domain().end());
+    // Scattered accesses
+    std::random_shuffle(points.begin(), points.end());
+    long nbErrors = 0;
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic, 256) reduction(+:nbErrors)
+#endif
+    for (long k = 0; k < (long)points.size(); k++)
+      if (tiledImage(points[k]) != image(points[k]))
+        nbErrors++;
+
+    trace.info() << "Errors: " << nbErrors << ", read misses: " << tiledImage.getCacheMissRead()
+                 << ", evictions: " << imageCacheReadPolicy.nbEvictions() << endl;
+    nbok += (nbErrors == 0) ? 1 : 0;
+    nb++;
+    nbok += (imageCacheReadPolicy.nbBytes() <= imageCacheReadPolicy.byteBudget()) ? 1 : 0;
+    nb++;
+
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
+bool testPrefetching()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing TiledImage with tile prefetching");
+
+    typedef ImageContainerBySTLVector<Z3i::Domain, int> VImage;
+    VImage image(Z3i::Domain(Z3i::Point(0,0,0), Z3i::Point(31,31,31)));
+
+    int i = 1;
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+        *it = i++;
+
+    typedef ImageFactoryFromImage<VImage> MyImageFactoryFromImage;
+    typedef AsyncImageFactory<MyImageFactoryFromImage> MyAsyncImageFactory;
+    typedef MyAsyncImageFactory::OutputImage OutputImage;
+    MyImageFactoryFromImage imageFactoryFromImage(image);
+    MyAsyncImageFactory asyncImageFactory(imageFactoryFromImage, true);
+
+    typedef ImageCacheReadPolicyFIFO<OutputImage, MyAsyncImageFactory> MyImageCacheReadPolicyFIFO;
+    typedef ImageCacheWritePolicyWB<OutputImage, MyAsyncImageFactory> MyImageCacheWritePolicyWB;
+    MyImageCacheReadPolicyFIFO imageCacheReadPolicyFIFO(asyncImageFactory, 2);
+    MyImageCacheWritePolicyWB imageCacheWritePolicyWB(asyncImageFactory);
+
+    typedef TiledImage<VImage, MyAsyncImageFactory, MyImageCacheReadPolicyFIFO, MyImageCacheWritePolicyWB> MyTiledImage;
+    BOOST_CONCEPT_ASSERT(( concepts::CImage< MyTiledImage > ));
+    MyTiledImage tiledImage(asyncImageFactory, imageCacheReadPolicyFIFO, imageCacheWritePolicyWB, 4);
+    tiledImage.setPrefetching(2);
+
+    // Iteration order: tile by tile
+    std::vector<int> expected;
+    const Z3i::Domain blocks = tiledImage.domainBlockCoords();
+    for (Z3i::Domain::ConstIterator itBlock = blocks.begin(); itBlock != blocks.end(); ++itBlock)
+    {
+      const Z3i::Domain tile = tiledImage.findSubDomainFromBlockCoords(*itBlock);
+      for (Z3i::Domain::ConstIterator it = tile.begin(); it != tile.end(); ++it)
+        expected.push_back(image(*it));
+    }
+    unsigned int nbErrors = 0;
+    std::size_t k = 0;
+    for (MyTiledImage::ConstIterator it = tiledImage.begin(), itEnd = tiledImage.end(); it != itEnd; ++it, ++k)
+      if (k >= expected.size() || *it != expected[k])
+        nbErrors++;
+    trace.info() << "Errors: " << nbErrors << ", " << asyncImageFactory << endl;
+    nbok += ( (nbErrors == 0) && (asyncImageFactory.nbPrefetchHits() > 0) ) ? 1 : 0;
+    nb++;
+
+    // Writes are flushed on the worker thread, before the tiles are read again.
+    for (MyTiledImage::OutputIterator it = tiledImage.begin(), itEnd = tiledImage.end(); it != itEnd; ++it)
+      *it = -*it;
+    nbErrors = 0;
+    for (MyTiledImage::ConstIterator it = tiledImage.begin(), itEnd = tiledImage.end(); it != itEnd; ++it)
+      if (*it >= 0)
+        nbErrors++;
+    asyncImageFactory.wait();
+    trace.info() << "Errors: " << nbErrors << ", " << asyncImageFactory << endl;
+    nbok += ( (nbErrors == 0) && (asyncImageFactory.nbAsynchronousFlushes() > 0)
+              && (image(Z3i::Point(0,0,0)) == -1) && (image(Z3i::Point(20,9,13)) < 0) ) ? 1 : 0;
+    nb++;
+
+    // Access plan: the tiles in reverse order
+    std::vector<Z3i::Point> plan;
+    for (Z3i::Domain::ConstIterator it = blocks.begin(); it != blocks.end(); ++it)
+      plan.insert(plan.begin(), *it);
+    tiledImage.setPrefetching(3, plan);
+    const std::size_t nbPrefetchHits = asyncImageFactory.nbPrefetchHits();
+    nbErrors = 0;
+    for (k = 0; k < plan.size(); k++)
+    {
+      const Z3i::Domain tile = tiledImage.findSubDomainFromBlockCoords(plan[k]);
+      for (Z3i::Domain::ConstIterator it = tile.begin(); it != tile.end(); ++it)
+        if (tiledImage(*it) != image(*it))
+          nbErrors++;
+    }
+    trace.info() << "Errors: " << nbErrors << ", " << asyncImageFactory << endl;
+    nbok += ( (nbErrors == 0) && (asyncImageFactory.nbPrefetchHits() > nbPrefetchHits) ) ? 1 : 0;
+    nb++;
+
+    // Write-through: flushes are synchronous by default.
+    asyncImageFactory.wait();
+    MyAsyncImageFactory syncImageFactory(imageFactoryFromImage);
+    typedef ImageCacheWritePolicyWT<OutputImage, MyAsyncImageFactory> MyImageCacheWritePolicyWT;
+    MyImageCacheReadPolicyFIFO syncReadPolicyFIFO(syncImageFactory, 2);
+    MyImageCacheWritePolicyWT imageCacheWritePolicyWT(syncImageFactory);
+    typedef TiledImage<VImage, MyAsyncImageFactory, MyImageCacheReadPolicyFIFO, MyImageCacheWritePolicyWT> MyWTTiledImage;
+    MyWTTiledImage wtTiledImage(syncImageFactory, syncReadPolicyFIFO, imageCacheWritePolicyWT, 4);
+    wtTiledImage.setValue(Z3i::Point(5,6,7), 42);
+    trace.info() << syncImageFactory << endl;
+    nbok += ( (! syncImageFactory.isAsynchronousFlush()) && (image(Z3i::Point(5,6,7)) == 42)
+              && (syncImageFactory.nbAsynchronousFlushes() == 0) ) ? 1 : 0;
+    nb++;
+
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -338,7 +494,8 @@ int main( int argc, char** argv )
         trace.info() << " " << argv[ i ];
     trace.info() << endl;
 
-    bool res = testSimple() && test3d() && testIterators() && test_range_constRange(); // && ... other tests
+    bool res = testSimple() && test3d() && testIterators() && test_range_constRange()
+      && testConcurrentReads() && testPrefetching(); // && ... other tests
 
     trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
     trace.endBlock();
@@ -0,0 +1,242 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing classes BrickVolReader, BrickVolWriter,
+ * BrickVolFile and ImageFactoryFromBrickVol.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageCache.h"
+#include "DGtal/images/TiledImage.h"
+#include "DGtal/images/ImageFactoryFromBrickVol.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/readers/BrickVolReader.h"
+#include "DGtal/io/writers/BrickVolWriter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing the brick vol format.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing BrickVolReader and BrickVolWriter" )
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+  typedef ImageContainerBySTLMap<Z3i::Domain, unsigned char> MapImage;
+  typedef BrickVolFile<Z3i::Domain, unsigned char> File;
+
+  const std::string filename = testOutputPath + "testBrickVolReader.bvol";
+  Image image = VolReader<Image>::importVol( testPath + "samples/lobsterCroped.vol" );
+  const Z3i::Domain domain = image.domain();
+
+  SECTION( "Whole images, with both codecs" )
+    {
+      for ( File::Codec codec : { File::ZLIB, File::RAW } )
+        {
+          REQUIRE( BrickVolWriter<Image>::exportBrickVol( filename, image,
+                                                          Z3i::Vector( 16, 8, 5 ), codec ) );
+          File file( filename );
+          REQUIRE( file.isValid() );
+          REQUIRE( file.codec() == codec );
+          REQUIRE( file.domain().lowerBound() == domain.lowerBound() );
+          REQUIRE( file.domain().upperBound() == domain.upperBound() );
+
+          Image read = BrickVolReader<Image>::importBrickVol( filename );
+          REQUIRE( std::equal( image.begin(), image.end(), read.begin() ) );
+        }
+    }
+
+  SECTION( "Regions of interest" )
+    {
+      BrickVolWriter<Image>::exportBrickVol( filename, image,
+                                             Z3i::Vector( 16, 16, 16 ) );
+      const Z3i::Point low = domain.lowerBound() + Z3i::Vector( 5, 20, 3 );
+      const Z3i::Point up  = domain.upperBound() + Z3i::Vector( 10, -7, 4 );
+      Image roi = BrickVolReader<Image>::importBrickVol( filename,
+                                                         Z3i::Domain( low, up ) );
+      MapImage mapRoi = BrickVolReader<MapImage>::importBrickVol( filename,
+                                                                  Z3i::Domain( low, up ) );
+      // The region is clipped to the domain of the file.
+      REQUIRE( roi.domain().lowerBound() == low );
+      REQUIRE( roi.domain().upperBound() == up.inf( domain.upperBound() ) );
+      unsigned int nbDifferences = 0;
+      for ( auto p : roi.domain() )
+        {
+          if ( roi( p ) != image( p ) ) ++nbDifferences;
+          if ( mapRoi( p ) != image( p ) ) ++nbDifferences;
+        }
+      REQUIRE( nbDifferences == 0 );
+
+      const Z3i::Point far = domain.upperBound() + Z3i::Vector::diagonal( 10 );
+      REQUIRE_THROWS_AS( BrickVolReader<Image>::importBrickVol( filename,
+                                                                Z3i::Domain( far, far ) ),
+                         IOException );
+    }
+
+  SECTION( "Bool images" )
+    {
+      typedef ImageContainerBySTLVector<Z3i::Domain, bool> BoolImage;
+      BoolImage binary( domain );
+      for ( auto p : domain ) binary.setValue( p, image( p ) > 100 );
+      {
+        File file( filename, domain, Z3i::Vector( 16, 8, 5 ) );
+        file.writeFrom( binary );
+      }
+      File file( filename );
+      BoolImage read( domain );
+      file.readInto( read );
+      const Z3i::Domain roiDomain( domain.lowerBound() + Z3i::Vector( 3, 5, 2 ),
+                                   domain.upperBound() - Z3i::Vector( 7, 1, 4 ) );
+      BoolImage roi( roiDomain );
+      file.readInto( roi );
+      unsigned int nbDifferences = 0;
+      for ( auto p : domain )
+        if ( read( p ) != binary( p ) ) ++nbDifferences;
+      for ( auto p : roiDomain )
+        if ( roi( p ) != binary( p ) ) ++nbDifferences;
+      REQUIRE( nbDifferences == 0 );
+    }
+
+  SECTION( "Invalid files" )
+    {
+      BrickVolWriter<Image>::exportBrickVol( filename, image );
+      typedef ImageContainerBySTLVector<Z3i::Domain, int> IntImage;
+      typedef ImageContainerBySTLVector<Z2i::Domain, unsigned char> Image2D;
+      REQUIRE_THROWS_AS( BrickVolReader<IntImage>::importBrickVol( filename ),
+                         IOException );
+      REQUIRE_THROWS_AS( BrickVolReader<Image2D>::importBrickVol( filename ),
+                         IOException );
+      REQUIRE_THROWS_AS( BrickVolReader<Image>::importBrickVol( testPath + "samples/cat10.vol" ),
+                         IOException );
+    }
+}
+
+TEST_CASE( "Testing ImageFactoryFromBrickVol with TiledImage" )
+{
+  typedef ImageContainerBySTLVector<Z2i::Domain, int> Image;
+  Z2i::Domain domain( Z2i::Point( -10, 3 ), Z2i::Point( 29, 42 ) );
+  Image image( domain );
+  int i = 0;
+  for ( auto p : domain ) image.setValue( p, i++ * 7 - 300 );
+  // 40x40 image, 4x4 tiles of 10x10 pixels, the extent of the bricks.
+  const std::string filename = testOutputPath + "testBrickVolReader2D.bvol";
+  BrickVolWriter<Image>::exportBrickVol( filename, image,
+                                         Z2i::Vector( 10, 10 ) );
+
+  typedef ImageFactoryFromBrickVol<Image> Factory;
+  typedef Factory::OutputImage OutputImage;
+  typedef ImageCacheReadPolicyLAST<OutputImage, Factory> ReadPolicy;
+  typedef ImageCacheWritePolicyWT<OutputImage, Factory> WritePolicy;
+  typedef TiledImage<Image, Factory, ReadPolicy, WritePolicy> Tiled;
+
+  SECTION( "Reading tiles" )
+    {
+      Factory factory( filename );
+      REQUIRE( factory.isValid() );
+      ReadPolicy readPolicy( factory );
+      WritePolicy writePolicy( factory );
+      Tiled tiled( factory, readPolicy, writePolicy, 4 );
+      unsigned int nbDifferences = 0;
+      for ( auto p : domain )
+        if ( tiled( p ) != image( p ) ) ++nbDifferences;
+      REQUIRE( nbDifferences == 0 );
+
+      // Unaligned requests read several bricks.
+      Z2i::Domain unaligned( Z2i::Point( -5, 8 ), Z2i::Point( 17, 30 ) );
+      OutputImage* output = factory.requestImage( unaligned );
+      for ( auto p : unaligned )
+        if ( (*output)( p ) != image( p ) ) ++nbDifferences;
+      REQUIRE( nbDifferences == 0 );
+      // The factory is read-only.
+      REQUIRE_THROWS_AS( factory.flushImage( output ), IOException );
+      factory.detachImage( output );
+    }
+
+  SECTION( "Writing tiles" )
+    {
+      {
+        Factory factory( filename, true );
+        ReadPolicy readPolicy( factory );
+        WritePolicy writePolicy( factory );
+        Tiled tiled( factory, readPolicy, writePolicy, 4 );
+        tiled.setValue( Z2i::Point( -10, 3 ), 1000 );
+        tiled.setValue( Z2i::Point( 15, 25 ), 2000 );
+        image.setValue( Z2i::Point( -10, 3 ), 1000 );
+        image.setValue( Z2i::Point( 15, 25 ), 2000 );
+
+        // A flushed image covering parts of several bricks.
+        Z2i::Domain part( Z2i::Point( 5, 10 ), Z2i::Point( 12, 14 ) );
+        OutputImage* output = factory.requestImage( part );
+        for ( auto p : part )
+          {
+            output->setValue( p, -p[ 0 ] * p[ 1 ] );
+            image.setValue( p, -p[ 0 ] * p[ 1 ] );
+          }
+        factory.flushImage( output );
+        factory.detachImage( output );
+      }
+      Image read = BrickVolReader<Image>::importBrickVol( filename );
+      REQUIRE( std::equal( image.begin(), image.end(), read.begin() ) );
+    }
+
+  SECTION( "Rewritten bricks that fit are overwritten" )
+    {
+      const auto fileSize = [ &filename ] ()
+        {
+          std::ifstream in( filename.c_str(), std::ios::binary | std::ios::ate );
+          return (std::size_t) in.tellg();
+        };
+      const std::size_t size = fileSize();
+      {
+        BrickVolFile<Z2i::Domain, int> file( filename, true );
+        std::vector<int> values( 100 );
+        file.readBrick( 5, values.data() );
+        for ( unsigned int k = 0; k < 10; ++k ) file.writeBrick( 5, values.data() );
+        // A brick of zeros is smaller.
+        std::vector<int> zeros( 100, 0 );
+        file.writeBrick( 6, zeros.data() );
+      }
+      REQUIRE( fileSize() == size );
+      Image read = BrickVolReader<Image>::importBrickVol( filename );
+      unsigned int nbDifferences = 0;
+      for ( auto p : domain )
+        {
+          const bool inBrick6 = p[ 0 ] >= 10 && p[ 0 ] < 20 && p[ 1 ] >= 13 && p[ 1 ] < 23;
+          if ( read( p ) != ( inBrick6 ? 0 : image( p ) ) ) ++nbDifferences;
+        }
+      REQUIRE( nbDifferences == 0 );
+    }
+}
+
+/** @ingroup Tests **/
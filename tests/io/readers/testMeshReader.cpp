@@ -32,7 +32,13 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/shapes/Mesh.h"
 #include "DGtal/io/readers/MeshReader.h"
+#include "DGtal/io/readers/SurfaceMeshReader.h"
+#include "DGtal/io/writers/MeshWriter.h"
 #include "DGtal/helpers/StdDefs.h"
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <cmath>
 
 #include "ConfigTest.h"
 
@@ -129,6 +135,119 @@ bool testMeshReader()
   return nbok == nb;
 }
 
+/**
+ * Parsing of OFF, OBJ and binary PLY files and round trips through
+ * MeshWriter.
+ */
+bool testMeshFileFormats()
+{
+  typedef Z3i::RealPoint RealPoint;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing mesh file formats ..." );
+
+  // Numbers
+  bool numbersOK = true;
+  double value = 0.0;
+  const char* numbers[] = { "0.1", "-1e-3", "123456789012345678901234", "2.5E+2",
+                            "3.141592653589793238", "1e-320", "+7" };
+  for ( const char* n : numbers )
+    numbersOK = numbersOK
+      && detail::MeshFileIO::parseReal( n, n + strlen( n ), value ) == n + strlen( n )
+      && value == strtod( n, nullptr );
+  for ( int i = 1; i < 1000; ++i )
+    {
+      char text[ 32 ];
+      const double x = std::sin( (double) i ) * std::pow( 10.0, i % 40 - 20 );
+      snprintf( text, sizeof( text ), "%.17g", x );
+      numbersOK = numbersOK
+        && detail::MeshFileIO::parseReal( text, text + strlen( text ), value ) != nullptr
+        && value == x;
+    }
+  nbok += numbersOK ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") parsed numbers" << std::endl;
+
+  // OFF with comments, counts after the keyword, CRLF and colors
+  {
+    std::ofstream out( "testMeshReader.off", std::ofstream::binary );
+    out << "OFF 4 2 0\r\n# a comment\r\n\r\n0 0 0\r\n1 0 0\r\n0 1 0\r\n 0 0 1.5\r\n"
+        << "3 0 1 2 1.0 0.0 0.0\r\n3 0 3 1\r\n";
+  }
+  Mesh<RealPoint> offMesh( true );
+  bool offOK = offMesh << std::string( "testMeshReader.off" );
+  offOK = offOK && offMesh.nbVertex() == 4 && offMesh.nbFaces() == 2
+    && offMesh.getVertex( 3 ) == RealPoint( 0, 0, 1.5 )
+    && offMesh.getFace( 1 ) == Mesh<RealPoint>::MeshFace( { 0, 3, 1 } )
+    && offMesh.getFaceColor( 0 ) == Color( 255, 0, 0, 255 )
+    && offMesh.getFaceColor( 1 ) == Color::White;
+  nbok += offOK ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") OFF file" << std::endl;
+
+  // OBJ with relative indices and normals
+  typedef SurfaceMeshReader< RealPoint, RealPoint > SMReader;
+  std::istringstream obj( "# cube corner\nv 0 0 0\nv 1 0 0\nv 0 1 0\nvn 0 0 1\n"
+                          "f 1//1 2//1 3//1\nv 0 0 1\nf -1//-1 -3/7/1 -4//1\nf 1//1 1//1 2//1\n" );
+  SMReader::SurfaceMesh objMesh;
+  bool objOK = SMReader::readOBJ( obj, objMesh );
+  objOK = objOK && objMesh.nbVertices() == 4 && objMesh.nbFaces() == 2
+    && objMesh.incidentVertices( 1 ) == SMReader::Vertices( { 3, 1, 0 } )
+    && objMesh.faceNormals().size() == 2
+    && objMesh.faceNormals()[ 0 ] == RealPoint( 0, 0, 1 );
+  nbok += objOK ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") OBJ stream" << std::endl;
+
+  // A mesh large enough to be split in several chunks.
+  Mesh<RealPoint> grid;
+  const int n = 150;
+  for ( int y = 0; y < n; ++y )
+    for ( int x = 0; x < n; ++x )
+      grid.addVertex( RealPoint( x / 7.0, y / 3.0, std::cos( x * y / 11.0 ) ) );
+  for ( int y = 0; y + 1 < n; ++y )
+    for ( int x = 0; x + 1 < n; ++x )
+      {
+        if ( ( x + y ) % 2 == 0 )
+          grid.addFace( { (unsigned int) ( y * n + x ), (unsigned int) ( y * n + x + 1 ),
+                          (unsigned int) ( ( y + 1 ) * n + x + 1 ), (unsigned int) ( ( y + 1 ) * n + x ) } );
+        else
+          grid.addTriangularFace( y * n + x, y * n + x + 1, ( y + 1 ) * n + x );
+      }
+  auto sameMesh = [] ( const Mesh<RealPoint> & a, const Mesh<RealPoint> & b )
+    {
+      bool same = a.nbVertex() == b.nbVertex() && a.nbFaces() == b.nbFaces();
+      for ( unsigned int i = 0; same && i < a.nbVertex(); ++i )
+        same = a.getVertex( i ) == b.getVertex( i );
+      for ( unsigned int i = 0; same && i < a.nbFaces(); ++i )
+        same = a.getFace( i ) == b.getFace( i );
+      return same;
+    };
+  {
+    std::ofstream out( "testMeshReader2.off" );
+    out.precision( 17 );
+    MeshWriter<RealPoint>::export2OFF( out, grid, false );
+  }
+  Mesh<RealPoint> offGrid;
+  bool gridOK = ( offGrid << std::string( "testMeshReader2.off" ) ) && sameMesh( grid, offGrid );
+  nbok += gridOK ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") OFF round trip" << std::endl;
+
+  Mesh<RealPoint> plyGrid;
+  bool plyOK = ( grid >> std::string( "testMeshReader.ply" ) )
+    && ( plyGrid << std::string( "testMeshReader.ply" ) ) && sameMesh( grid, plyGrid );
+  SMReader::SurfaceMesh plySurfaceMesh;
+  plyOK = plyOK && SMReader::readPLY( "testMeshReader.ply", plySurfaceMesh )
+    && plySurfaceMesh.nbFaces() == grid.nbFaces();
+  nbok += plyOK ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") PLY round trip" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -140,7 +259,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testMeshReader(); // && ... other tests
+  bool res = testMeshReader() && testMeshFileFormats(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
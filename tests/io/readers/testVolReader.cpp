@@ -39,6 +39,9 @@
 #include "DGtal/io/colormaps/GradientColorMap.h"
 #include "DGtal/io/colormaps/ColorBrightnessColorMap.h"
 #include "DGtal/io/writers/VolWriter.h"
+#include "DGtal/io/readers/LongvolReader.h"
+#include "DGtal/io/writers/LongvolWriter.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
 
 #include "ConfigTest.h"
 
@@ -166,6 +169,98 @@ bool testConsistence()
   return true;
 }
 
+/**
+ * Vol and longvol files, compressed or not, give the same images
+ * whether they are read in the storage of an ImageContainerBySTLVector
+ * or through setValue.
+ */
+bool testBulkImport()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing bulk import of vol and longvol files ..." );
+  typedef SpaceND<3> Space3;
+  typedef HyperRectDomain<Space3> TDomain;
+  typedef TDomain::Point Point;
+  typedef ImageContainerBySTLVector<TDomain, unsigned char> Image;
+  typedef ImageContainerBySTLVector<TDomain, int> IntImage;
+  typedef ImageContainerBySTLMap<TDomain, unsigned char> MapImage;
+  typedef ImageContainerBySTLVector<TDomain, bool> BoolImage;
+  typedef ImageContainerBySTLVector<TDomain, DGtal::uint64_t> LongImage;
+  typedef ImageContainerBySTLMap<TDomain, DGtal::uint64_t> LongMapImage;
+
+  TDomain domain( Point( -7, -3, 2 ), Point( 30, 17, 12 ) );
+  Image image( domain );
+  LongImage longImage( domain );
+  unsigned int i = 0;
+  for ( auto p : domain )
+    {
+      image.setValue( p, (unsigned char) ( ( 37 * i ) % 256 ) );
+      longImage.setValue( p, ( DGtal::uint64_t( i ) << 35 ) + 3 * i + 1 );
+      ++i;
+    }
+
+  for ( bool compressed : { false, true } )
+    {
+      VolWriter<Image>::exportVol( "testBulkImport.vol", image, compressed );
+      Image vecImage = VolReader<Image>::importVol( "testBulkImport.vol" );
+      IntImage intImage = VolReader<IntImage>::importVol( "testBulkImport.vol" );
+      MapImage mapImage = VolReader<MapImage>::importVol( "testBulkImport.vol" );
+      BoolImage boolImage = VolReader<BoolImage>::importVol( "testBulkImport.vol" );
+      bool same = vecImage.domain().lowerBound() == domain.lowerBound()
+        && vecImage.domain().upperBound() == domain.upperBound();
+      for ( auto p : domain )
+        same = same && vecImage( p ) == image( p ) && intImage( p ) == (int) image( p )
+          && mapImage( p ) == image( p ) && boolImage( p ) == ( image( p ) != 0 );
+      nbok += same ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "vol, compressed=" << compressed << std::endl;
+
+      LongvolWriter<LongImage>::exportLongvol( "testBulkImport.longvol", longImage, compressed );
+      LongImage vecLongImage = LongvolReader<LongImage>::importLongvol( "testBulkImport.longvol" );
+      LongMapImage mapLongImage = LongvolReader<LongMapImage>::importLongvol( "testBulkImport.longvol" );
+      BoolImage boolLongImage = LongvolReader<BoolImage>::importLongvol( "testBulkImport.longvol" );
+      same = vecLongImage.domain().lowerBound() == domain.lowerBound()
+        && vecLongImage.domain().upperBound() == domain.upperBound();
+      for ( auto p : domain )
+        same = same && vecLongImage( p ) == longImage( p ) && mapLongImage( p ) == longImage( p )
+          && boolLongImage( p );
+      nbok += same ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "longvol, compressed=" << compressed << std::endl;
+    }
+
+  // A truncated payload is an error.
+  {
+    VolWriter<Image>::exportVol( "testBulkImport.vol", image, false );
+    std::ifstream in( "testBulkImport.vol", std::ios::binary );
+    std::string content( ( std::istreambuf_iterator<char>( in ) ), std::istreambuf_iterator<char>() );
+    in.close();
+    std::ofstream out( "testBulkImport-truncated.vol", std::ios::binary );
+    out << content.substr( 0, content.size() - 10 );
+    out.close();
+    bool thrown = false;
+    try
+      {
+        Image truncated = VolReader<Image>::importVol( "testBulkImport-truncated.vol" );
+      }
+    catch ( DGtal::IOException & )
+      {
+        thrown = true;
+      }
+    nbok += thrown ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") "
+                 << "truncated vol" << std::endl;
+  }
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -180,7 +275,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testVolReader() && testIOException() && testConsistence(); // && ... other tests
+  bool res = testVolReader() && testIOException() && testConsistence()
+    && testBulkImport(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
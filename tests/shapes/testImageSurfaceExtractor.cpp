@@ -0,0 +1,196 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class ImageSurfaceExtractor.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <map>
+#include <set>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/shapes/ImageSurfaceExtractor.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Shortcuts<Z3i::KSpace>                      SH3;
+typedef ImageSurfaceExtractor<SH3::BinaryImage>     Extractor;
+typedef std::vector<std::size_t>                    Face;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageSurfaceExtractor.
+///////////////////////////////////////////////////////////////////////////////
+
+/// @return the face starting at its smallest vertex.
+Face canonicFace( Face f )
+{
+  std::rotate( f.begin(), std::min_element( f.begin(), f.end() ), f.end() );
+  return f;
+}
+
+/// @return the faces of a polygonal surface, whose vertices are
+/// renumbered as the vertices at the same position in positions.
+std::multiset<Face> facesByPositions( const SH3::PolygonalSurface& surface,
+                                      const Extractor::RealPoints& positions )
+{
+  std::map<Z3i::RealPoint, std::size_t> index;
+  for ( std::size_t i = 0; i < positions.size(); ++i )
+    index[ positions[ i ] ] = i;
+  std::multiset<Face> faces;
+  for ( std::size_t f = 0; f < surface.nbFaces(); ++f )
+    {
+      Face face;
+      for ( auto v : surface.verticesAroundFace( f ) )
+        {
+          auto it = index.find( surface.position( v ) );
+          face.push_back( it == index.end() ? positions.size() : it->second );
+        }
+      faces.insert( canonicFace( face ) );
+    }
+  return faces;
+}
+
+SCENARIO( "ImageSurfaceExtractor extracts the same meshes as the digital surface", "[ImageSurfaceExtractor]" )
+{
+  auto params = SH3::defaultParameters();
+  params( "polynomial", "goursat" )( "gridstep", 1.0 )( "noise", 0.3 );
+  auto shape   = SH3::makeImplicitShape3D( params );
+  auto dshape  = SH3::makeDigitizedImplicitShape3D( shape, params );
+  auto bimage  = SH3::makeBinaryImage( dshape, params );
+  auto K       = SH3::getKSpace( params );
+
+  for ( int adjacency = 0; adjacency < 2; ++adjacency )
+    {
+      params( "surfelAdjacency", adjacency );
+      auto surface = SH3::makeDigitalSurface( bimage, K, params );
+      auto dual    = SH3::makeDualPolygonalSurface( surface );
+      Extractor extractor( *bimage, false, adjacency == 1 );
+      Extractor::RealPoints positions;
+      Extractor::Faces      faces;
+      extractor.extractDual( positions, faces );
+      std::multiset<Face> extractedFaces;
+      for ( const auto& f : faces ) extractedFaces.insert( canonicFace( f ) );
+      GIVEN( "A noisy digitized goursat and surfel adjacency " << adjacency )
+        {
+          THEN( "The dual mesh has the vertices and the faces of the dual polygonal surface" )
+            {
+              REQUIRE( extractor.isValid() );
+              REQUIRE( extractor.nbSurfels() == surface->size() );
+              REQUIRE( positions.size() == dual->nbVertices() );
+              REQUIRE( faces.size() == dual->nbFaces() );
+              REQUIRE( facesByPositions( *dual, positions ) == extractedFaces );
+            }
+          THEN( "Surfels are inside the shape on one side and outside on the other" )
+            {
+              unsigned int nbErrors = 0;
+              for ( std::size_t i = 0; i < extractor.nbSurfels(); ++i )
+                {
+                  auto s = extractor.surfel( i );
+                  Z3i::Point next = s.first;
+                  next[ s.second ] += 1;
+                  if ( extractor.isInside( s.first ) == extractor.isInside( next ) ) ++nbErrors;
+                }
+              REQUIRE( nbErrors == 0 );
+            }
+          THEN( "The shortcuts build the same meshes" )
+            {
+              auto triSurf = SH3::makeTriangulatedSurface( bimage, params );
+              auto mesh    = SH3::makeDualSurfaceMesh( bimage, params );
+              std::size_t nbTriangles = 0, nbOthers = 0;
+              for ( const auto& f : faces )
+                {
+                  if ( f.size() == 3 ) ++nbTriangles;
+                  else { ++nbOthers; nbTriangles += f.size(); }
+                }
+              REQUIRE( triSurf->nbVertices() == positions.size() + nbOthers );
+              REQUIRE( triSurf->nbFaces() == nbTriangles );
+              REQUIRE( mesh->nbVertices() == positions.size() );
+              REQUIRE( mesh->nbFaces() == faces.size() );
+              REQUIRE( SH3::makeDualPolygonalSurface( bimage, params )->nbFaces() == faces.size() );
+            }
+        }
+    }
+
+  GIVEN( "A digitized goursat without noise" )
+    {
+      params( "noise", 0.0 );
+      auto image   = SH3::makeBinaryImage( dshape, params );
+      auto surface = SH3::makeDigitalSurface( image, K, params );
+      auto primal  = SH3::makePrimalPolygonalSurface( surface );
+      Extractor extractor( *image, false );
+      Extractor::RealPoints positions;
+      Extractor::Faces      faces;
+      extractor.extractPrimal( positions, faces );
+      std::multiset<Face> extractedFaces;
+      for ( const auto& f : faces ) extractedFaces.insert( canonicFace( f ) );
+      THEN( "The primal mesh has the vertices and the faces of the primal polygonal surface" )
+        {
+          REQUIRE( primal.get() != nullptr );
+          REQUIRE( positions.size() == primal->nbVertices() );
+          REQUIRE( faces.size() == primal->nbFaces() );
+          REQUIRE( facesByPositions( *primal, positions ) == extractedFaces );
+          REQUIRE( SH3::makePrimalPolygonalSurface( image ).get() != nullptr );
+          REQUIRE( SH3::makePrimalSurfaceMesh( image )->nbFaces() == faces.size() );
+        }
+    }
+}
+
+SCENARIO( "ImageSurfaceExtractor places vertices on the iso-surface of a gray-scale image", "[ImageSurfaceExtractor]" )
+{
+  const Z3i::Domain domain( Z3i::Point( -12, -12, -12 ), Z3i::Point( 12, 12, 12 ) );
+  CountedPtr<SH3::GrayScaleImage> image( new SH3::GrayScaleImage( domain ) );
+  for ( auto p : domain )
+    {
+      double v = 128.0 + 12.0 * ( 9.5 - ( p - Z3i::Point::zero ).norm() );
+      image->setValue( p, (unsigned char) std::max( 0.0, std::min( 255.0, v ) ) );
+    }
+  auto params = SH3::defaultParameters();
+  params( "thresholdMin", 128 )( "gridsizex", 0.5 )( "gridsizey", 0.5 )( "gridsizez", 0.5 );
+  auto polySurf = SH3::makePolygonalSurface( image, params );
+  auto mesh     = SH3::makeDualSurfaceMesh( image, params );
+  THEN( "The vertices are the ones given by the linear cell embedder" )
+    {
+      REQUIRE( mesh->nbVertices() == polySurf->nbVertices() );
+      REQUIRE( mesh->nbFaces() == polySurf->nbFaces() );
+      std::vector<Z3i::RealPoint> expected, computed;
+      for ( std::size_t v = 0; v < polySurf->nbVertices(); ++v )
+        expected.push_back( polySurf->position( v ) );
+      computed = mesh->positions();
+      std::sort( expected.begin(), expected.end() );
+      std::sort( computed.begin(), computed.end() );
+      unsigned int nbErrors = 0;
+      for ( std::size_t i = 0; i < expected.size(); ++i )
+        if ( ( expected[ i ] - computed[ i ] ).norm() > 1e-9 ) ++nbErrors;
+      REQUIRE( nbErrors == 0 );
+    }
+}
+
+/** @ingroup Tests **/
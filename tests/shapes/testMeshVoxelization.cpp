@@ -36,6 +36,7 @@
 #include "DGtal/io/Display3D.h"
 #include "DGtal/io/readers/MeshReader.h"
 #include "DGtal/io/boards/Board3D.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace DGtal;
@@ -232,4 +233,59 @@ TEST_CASE("Basic voxelization test", "[voxelization]")
     //hard coded test.
     REQUIRE( outputSet.size() == 4162 );
   }
+  // ---------------------------------------------------------
+  SECTION("Parallel voxelization of a OFF cube mesh, triangle by triangle")
+  {
+    Mesh<Z3i::RealPoint> inputMesh;
+    MeshReader<Z3i::RealPoint>::importOFFFile(testPath +"/samples/box.off" , inputMesh);
+    Z3i::Domain domain( Point().diagonal(-30), Point(30, 5, 30));
+    DigitalSet expectedSet(domain);
+    MeshVoxelizer26 voxelizer;
+    for(unsigned int i = 0; i < inputMesh.nbFaces(); i++)
+    {
+      const auto & face = inputMesh.getFace(i);
+      for(unsigned int j = 0; j + 2 < face.size(); ++j)
+        voxelizer.voxelize(expectedSet, inputMesh.getVertex(face[0]),
+                           inputMesh.getVertex(face[j+1]),
+                           inputMesh.getVertex(face[j+2]), 10.0);
+    }
+
+    auto voxels = voxelizer.surfaceVoxels(inputMesh, domain, 10.0);
+    REQUIRE( voxels.size() == expectedSet.size() );
+    REQUIRE( std::unique(voxels.begin(), voxels.end()) == voxels.end() );
+    unsigned int nbOutside = 0;
+    for(auto p: voxels)
+      if ( ! expectedSet(p) ) ++nbOutside;
+    REQUIRE( nbOutside == 0 );
+  }
+  // ---------------------------------------------------------
+  SECTION("Solid voxelization of a OFF cube mesh in an image")
+  {
+    Mesh<Z3i::RealPoint> inputMesh;
+    MeshReader<Z3i::RealPoint>::importOFFFile(testPath +"/samples/box.off" , inputMesh);
+    Z3i::Domain domain( Point().diagonal(-30), Point().diagonal(30));
+    MeshVoxelizer6 voxelizer;
+
+    // |x|+|y| <= 16 and |z| <= 11, the points on the diagonal of the
+    // top and bottom faces being counted once.
+    auto interior = voxelizer.interiorVoxels(inputMesh, domain, 10.0);
+    REQUIRE( interior.size() == 545 * 23 );
+
+    ImageContainerBySTLVector<Z3i::Domain, unsigned char> image(domain);
+    voxelizer.voxelizeInImage(image, inputMesh, 1, 10.0);
+    unsigned int nbSurface = 0;
+    for(auto p: domain)
+      if ( image(p) == 1 ) ++nbSurface;
+    REQUIRE( nbSurface == 2562 );
+
+    voxelizer.voxelizeInImage(image, inputMesh, 1, 10.0, true);
+    unsigned int nbSolid = 0;
+    for(auto p: domain)
+      if ( image(p) == 1 ) ++nbSolid;
+    REQUIRE( nbSolid > interior.size() );
+    unsigned int nbUnset = 0;
+    for(auto p: interior)
+      if ( image(p) != 1 ) ++nbUnset;
+    REQUIRE( nbUnset == 0 );
+  }
 }
@@ -271,6 +271,78 @@ SCENARIO( "SurfaceMesh< RealPoint3 > mesh helper tests", "[surfmesh][helper]" )
   }
 }
 
+SCENARIO( "SurfaceMesh< RealPoint3 > relations of a large mesh", "[surfmesh][relations]" )
+{
+  typedef PointVector<3,double>                      RealPoint;
+  typedef PointVector<3,double>                      RealVector;
+  typedef SurfaceMesh< RealPoint, RealVector >       PolygonMesh;
+  typedef SurfaceMeshHelper< RealPoint, RealVector > PolygonMeshHelper;
+  typedef PolygonMeshHelper::NormalsType             NormalsType;
+  typedef PolygonMesh::Index                         Index;
+  GIVEN( "A torus with 200x150x2 triangles" ) {
+    auto polymesh = PolygonMeshHelper::makeTorus( 3.0, 1.0, RealPoint::zero,
+                                                  200, 150, 0, NormalsType::NO_NORMALS );
+    THEN( "Every vertex has 6 neighbors and 6 incident faces, every face has 3 neighbors" ) {
+      Index nb_wrong = 0;
+      for ( Index v = 0; v < polymesh.nbVertices(); ++v )
+        if ( polymesh.neighborVertices( v ).size() != 6
+             || polymesh.incidentFaces( v ).size() != 6 ) nb_wrong++;
+      for ( Index f = 0; f < polymesh.nbFaces(); ++f )
+        if ( polymesh.neighborFaces( f ).size() != 3 ) nb_wrong++;
+      REQUIRE( polymesh.nbFaces() == 2 * polymesh.nbVertices() );
+      REQUIRE( polymesh.nbEdges() == 3 * polymesh.nbVertices() );
+      REQUIRE( nb_wrong == 0 );
+    }
+    THEN( "Every side of a face is an edge with this face to its left or to its right" ) {
+      Index nb_wrong = 0;
+      for ( Index f = 0; f < polymesh.nbFaces(); ++f )
+        {
+          const auto& vtcs = polymesh.incidentVertices( f );
+          for ( Index i = 0; i < vtcs.size(); ++i )
+            {
+              const Index vi = vtcs[ i ];
+              const Index vj = vtcs[ ( i + 1 ) % vtcs.size() ];
+              const auto  e  = polymesh.makeEdge( vi, vj );
+              const auto& faces = vi < vj ? polymesh.edgeLeftFaces( e ) : polymesh.edgeRightFaces( e );
+              if ( e == polymesh.nbEdges()
+                   || std::find( faces.cbegin(), faces.cend(), f ) == faces.cend()
+                   || polymesh.edgeFaces( e ).size() != 2 ) nb_wrong++;
+            }
+        }
+      REQUIRE( nb_wrong == 0 );
+    }
+    THEN( "Face areas, centroids and normals are computed for every element" ) {
+      const auto areas     = polymesh.computeFaceAreas();
+      const auto centroids = polymesh.computeFaceCentroids();
+      REQUIRE( areas.size()     == polymesh.nbFaces() );
+      REQUIRE( centroids.size() == polymesh.nbFaces() );
+      Index nb_wrong = 0;
+      double total_area = 0.0;
+      for ( Index f = 0; f < polymesh.nbFaces(); ++f )
+        {
+          total_area += areas[ f ];
+          if ( areas[ f ] != polymesh.faceArea( f )
+               || centroids[ f ] != polymesh.faceCentroid( f ) ) nb_wrong++;
+        }
+      REQUIRE( nb_wrong == 0 );
+      // The area of a torus is 4 pi^2 R r.
+      REQUIRE( total_area == Approx( 4.0 * M_PI * M_PI * 3.0 ).epsilon( 0.01 ) );
+      polymesh.computeFaceNormalsFromPositions();
+      polymesh.computeVertexNormalsFromFaceNormalsWithMaxWeights();
+      REQUIRE( polymesh.vertexNormals().size() == polymesh.nbVertices() );
+      for ( Index v = 0; v < polymesh.nbVertices(); ++v )
+        {
+          // Normals point away from the core circle of the torus.
+          const RealPoint  x = polymesh.position( v );
+          const RealVector r = x - 3.0 * RealVector( x[ 0 ], x[ 1 ], 0.0 ).getNormalized();
+          if ( std::fabs( polymesh.vertexNormal( v ).norm() - 1.0 ) > 1e-10
+               || std::fabs( polymesh.vertexNormal( v ).dot( r ) ) < 0.99 ) nb_wrong++;
+        }
+      REQUIRE( nb_wrong == 0 );
+    }
+  }
+}
+
 SCENARIO( "SurfaceMesh< RealPoint3 > reader/writer tests", "[surfmesh][io]" )
 {
   typedef PointVector<3,double>                      RealPoint;
@@ -0,0 +1,207 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class SurfaceMeshBVH.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/SurfaceMesh.h"
+#include "DGtal/shapes/SurfaceMeshHelper.h"
+#include "DGtal/shapes/SurfaceMeshBVH.h"
+#include "DGtal/geometry/tools/RayIntersectionPredicates.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Z3i::RealPoint                          RealPoint;
+typedef SurfaceMesh< RealPoint, RealPoint >     Mesh;
+typedef SurfaceMeshHelper< RealPoint, RealPoint > Helper;
+typedef SurfaceMeshBVH< RealPoint, RealPoint >  BVH;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SurfaceMeshBVH.
+///////////////////////////////////////////////////////////////////////////////
+
+/// @return the distance between p and segment [a,b].
+double distanceToSegment( const RealPoint& p, const RealPoint& a, const RealPoint& b )
+{
+  const RealPoint ab = b - a;
+  const double    t  = std::max( 0.0, std::min( 1.0, ( p - a ).dot( ab ) / ab.dot( ab ) ) );
+  return ( p - ( a + ab * t ) ).norm();
+}
+
+/// @return the distance between p and triangle (a,b,c), by projection
+/// on its plane then on its sides.
+double distanceToTriangle( const RealPoint& p, const RealPoint& a,
+                           const RealPoint& b, const RealPoint& c )
+{
+  const RealPoint n  = ( b - a ).crossProduct( c - a );
+  const RealPoint q  = p - n * ( ( p - a ).dot( n ) / n.dot( n ) );
+  const RealPoint u  = b - a, v = c - a, w = q - a;
+  const double    uu = u.dot( u ), uv = u.dot( v ), vv = v.dot( v );
+  const double    wu = w.dot( u ), wv = w.dot( v ), d = uu * vv - uv * uv;
+  const double    s  = ( vv * wu - uv * wv ) / d;
+  const double    t  = ( uu * wv - uv * wu ) / d;
+  if ( s >= 0.0 && t >= 0.0 && s + t <= 1.0 ) return ( p - q ).norm();
+  return std::min( distanceToSegment( p, a, b ),
+                   std::min( distanceToSegment( p, b, c ), distanceToSegment( p, c, a ) ) );
+}
+
+SCENARIO( "SurfaceMeshBVH queries on a torus", "[SurfaceMeshBVH]" )
+{
+  const RealPoint center( 0.1, 0.2, 0.3 );
+  Mesh torus = Helper::makeTorus( 2.0, 0.7, center, 30, 24, 0,
+                                  Helper::NormalsType::NO_NORMALS );
+  BVH bvh( torus );
+  // Signed distance of a point to the exact torus.
+  auto torusDistance = [&center] ( const RealPoint& p )
+    {
+      const RealPoint r = p - center;
+      const double  rho = std::sqrt( r[ 0 ] * r[ 0 ] + r[ 1 ] * r[ 1 ] );
+      return std::sqrt( ( rho - 2.0 ) * ( rho - 2.0 ) + r[ 2 ] * r[ 2 ] ) - 0.7;
+    };
+  std::mt19937 gen( 7 );
+  std::uniform_real_distribution<double> U( -3.5, 3.5 );
+  std::vector<RealPoint> points( 300 );
+  for ( auto& p : points ) p = center + RealPoint( U( gen ), U( gen ), 0.4 * U( gen ) );
+
+  GIVEN( "A hierarchy over a quadrangulated torus" )
+    {
+      THEN( "It holds the triangles of the fans of the faces" )
+        {
+          std::size_t nbTriangles = 0;
+          for ( Mesh::Face f = 0; f < torus.nbFaces(); ++f )
+            nbTriangles += torus.incidentVertices( f ).size() - 2;
+          REQUIRE( bvh.isValid() );
+          REQUIRE( bvh.nbTriangles() == nbTriangles );
+          REQUIRE( bvh.nbNodes() > 0 );
+        }
+      THEN( "Closest points are the ones found by visiting all the faces" )
+        {
+          std::vector<RealPoint> projections;
+          BVH::Faces faces;
+          auto distances = bvh.closestPoints( points, projections, faces );
+          unsigned int nbErrors = 0;
+          for ( std::size_t i = 0; i < points.size(); ++i )
+            {
+              double expected = std::numeric_limits<double>::infinity();
+              for ( Mesh::Face f = 0; f < torus.nbFaces(); ++f )
+                {
+                  const auto& V = torus.incidentVertices( f );
+                  for ( std::size_t j = 1; j + 1 < V.size(); ++j )
+                    expected = std::min( expected, distanceToTriangle
+                                         ( points[ i ], torus.position( V[ 0 ] ),
+                                           torus.position( V[ j ] ),
+                                           torus.position( V[ j + 1 ] ) ) );
+                }
+              const auto& V = torus.incidentVertices( faces[ i ] );
+              double onFace = std::numeric_limits<double>::infinity();
+              for ( std::size_t j = 1; j + 1 < V.size(); ++j )
+                onFace = std::min( onFace, distanceToTriangle
+                                   ( projections[ i ], torus.position( V[ 0 ] ),
+                                     torus.position( V[ j ] ), torus.position( V[ j + 1 ] ) ) );
+              if ( std::fabs( distances[ i ] - expected ) > 1e-9
+                   || std::fabs( ( points[ i ] - projections[ i ] ).norm() - expected ) > 1e-9
+                   || onFace > 1e-9 )
+                ++nbErrors;
+            }
+          REQUIRE( nbErrors == 0 );
+        }
+      THEN( "Rays hit the mesh when they cross one of its triangles" )
+        {
+          unsigned int nbErrors = 0, nbHits = 0;
+          for ( const auto& p : points )
+            {
+              const RealPoint direction( U( gen ), U( gen ), U( gen ) );
+              double t;
+              Mesh::Face f;
+              const bool hit = bvh.intersectRay( p, direction, t, f );
+              RayIntersectionPredicate<RealPoint> ray( p, direction );
+              bool expected = false;
+              for ( Mesh::Face g = 0; g < torus.nbFaces(); ++g )
+                {
+                  const auto& V = torus.incidentVertices( g );
+                  for ( std::size_t j = 1; j + 1 < V.size(); ++j )
+                    expected = expected || ray( torus.position( V[ 0 ] ),
+                                                torus.position( V[ j ] ),
+                                                torus.position( V[ j + 1 ] ) );
+                }
+              if ( hit != expected ) ++nbErrors;
+              if ( ! hit ) continue;
+              ++nbHits;
+              // The hit point is on the mesh and nothing is hit before.
+              const RealPoint x = p + direction * t;
+              if ( bvh.distance( x ) > 1e-9 ) ++nbErrors;
+              double t2;
+              if ( bvh.intersectRay( p, direction, t2, f, t * ( 1.0 - 1e-9 ) ) ) ++nbErrors;
+            }
+          REQUIRE( nbHits > 0 );
+          REQUIRE( nbErrors == 0 );
+        }
+      THEN( "The winding number tells the inside from the outside" )
+        {
+          unsigned int nbErrors = 0;
+          for ( const auto& p : points )
+            {
+              const double d = torusDistance( p );
+              if ( std::fabs( d ) < 0.05 ) continue;
+              const double w = bvh.windingNumber( p, 0.0 );
+              if ( std::fabs( w - ( d < 0.0 ? 1.0 : 0.0 ) ) > 1e-9 ) ++nbErrors;
+              if ( std::fabs( bvh.windingNumber( p ) - w ) > 0.2 ) ++nbErrors;
+              if ( bvh.isInside( p ) != ( d < 0.0 ) ) ++nbErrors;
+              const double sd = bvh.signedDistance( p );
+              if ( ( sd < 0.0 ) != ( d < 0.0 ) || std::fabs( sd - d ) > 0.05 ) ++nbErrors;
+            }
+          REQUIRE( nbErrors == 0 );
+          auto sd = bvh.signedDistances( points );
+          REQUIRE( sd.size() == points.size() );
+          REQUIRE( sd[ 17 ] == bvh.signedDistance( points[ 17 ] ) );
+        }
+    }
+}
+
+SCENARIO( "SurfaceMeshBVH on an empty mesh", "[SurfaceMeshBVH]" )
+{
+  Mesh empty;
+  BVH bvh( empty );
+  RealPoint q;
+  Mesh::Face f;
+  double t;
+  REQUIRE( bvh.isValid() );
+  REQUIRE( bvh.nbTriangles() == 0 );
+  REQUIRE( bvh.closestPoint( RealPoint( 1, 2, 3 ), q, f ) == std::numeric_limits<double>::infinity() );
+  REQUIRE( ! bvh.intersectRay( RealPoint( 1, 2, 3 ), RealPoint( 1, 0, 0 ), t, f ) );
+  REQUIRE( bvh.windingNumber( RealPoint( 1, 2, 3 ) ) == 0.0 );
+}
+
+/** @ingroup Tests **/
@@ -180,6 +180,56 @@ HalfEdgeDataStructure makeBox()
 }
 
 
+/// A grid of quadrangles with scrambled vertex numbers.
+std::vector< PolygonalFace > makeGridQuadrangles( Size w, Size h )
+{
+  std::vector< Size > number( w * h );
+  for ( Size i = 0; i < number.size(); ++i ) number[ i ] = ( i * 7919 ) % number.size();
+  std::vector< PolygonalFace > faces;
+  for ( Size y = 0; y + 1 < h; ++y )
+    for ( Size x = 0; x + 1 < w; ++x )
+      faces.push_back( PolygonalFace( { number[ y * w + x ], number[ y * w + x + 1 ],
+                                        number[ ( y + 1 ) * w + x + 1 ],
+                                        number[ ( y + 1 ) * w + x ] } ) );
+  return faces;
+}
+
+/// The same grid, each quadrangle being split into two triangles.
+std::vector< Triangle > makeGridTriangles( Size w, Size h )
+{
+  std::vector< Triangle > triangles;
+  for ( const PolygonalFace& q : makeGridQuadrangles( w, h ) )
+    {
+      triangles.push_back( Triangle( q[ 0 ], q[ 1 ], q[ 2 ] ) );
+      triangles.push_back( Triangle( q[ 0 ], q[ 2 ], q[ 3 ] ) );
+    }
+  return triangles;
+}
+
+/// @return the number of differences between two half-edge data structures.
+Size nbDifferences( const HalfEdgeDataStructure& m1, const HalfEdgeDataStructure& m2 )
+{
+  if ( m1.nbHalfEdges() != m2.nbHalfEdges() || m1.nbVertices() != m2.nbVertices()
+       || m1.nbEdges() != m2.nbEdges() || m1.nbFaces() != m2.nbFaces() )
+    return 1;
+  Size nb = 0;
+  for ( Size i = 0; i < m1.nbHalfEdges(); ++i )
+    {
+      const HalfEdgeDataStructure::HalfEdge& he1 = m1.halfEdge( i );
+      const HalfEdgeDataStructure::HalfEdge& he2 = m2.halfEdge( i );
+      if ( he1.toVertex != he2.toVertex || he1.face != he2.face || he1.edge != he2.edge
+           || he1.opposite != he2.opposite || he1.next != he2.next ) ++nb;
+      if ( m1.halfEdgeIndexFromArc( m2.arcFromHalfEdgeIndex( i ) ) != i ) ++nb;
+    }
+  for ( Size v = 0; v < m1.nbVertices(); ++v )
+    if ( m1.halfEdgeIndexFromVertexIndex( v ) != m2.halfEdgeIndexFromVertexIndex( v ) ) ++nb;
+  for ( Size e = 0; e < m1.nbEdges(); ++e )
+    if ( m1.halfEdgeIndexFromEdgeIndex( e ) != m2.halfEdgeIndexFromEdgeIndex( e ) ) ++nb;
+  for ( Size f = 0; f < m1.nbFaces(); ++f )
+    if ( m1.halfEdgeIndexFromFaceIndex( f ) != m2.halfEdgeIndexFromFaceIndex( f ) ) ++nb;
+  return nb;
+}
+
 SCENARIO( "HalfEdgeDataStructure build", "[halfedge][build]" )
 {
   GIVEN( "Two triangles incident by an edge" ) {
@@ -392,6 +442,47 @@ SCENARIO( "HalfEdgeDataStructure build", "[halfedge][build]" )
 
 }
 
+SCENARIO( "HalfEdgeDataStructure build by sorting arcs", "[halfedge][build]" )
+{
+  GIVEN( "A large grid of triangles" ) {
+    const std::vector< Triangle > triangles = makeGridTriangles( 120, 100 );
+    std::vector< Edge > edges;
+    const Size nbVtx = HalfEdgeDataStructure::getUnorderedEdgesFromTriangles( triangles, edges );
+    HalfEdgeDataStructure mesh, expected;
+    REQUIRE( mesh.build( triangles ) );
+    REQUIRE( expected.build( nbVtx, triangles, edges ) );
+    THEN( "The mesh is valid and identical to the one built from its edges" ) {
+      REQUIRE( mesh.isValid() );
+      REQUIRE( mesh.nbVertices() == 120 * 100 );
+      REQUIRE( mesh.nbFaces() == 2 * 119 * 99 );
+      REQUIRE( nbDifferences( mesh, expected ) == 0 );
+    }
+  }
+  GIVEN( "A large grid of quadrangles" ) {
+    const std::vector< PolygonalFace > faces = makeGridQuadrangles( 120, 100 );
+    std::vector< Edge > edges;
+    const Size nbVtx = HalfEdgeDataStructure::getUnorderedEdgesFromPolygonalFaces( faces, edges );
+    HalfEdgeDataStructure mesh, expected;
+    REQUIRE( mesh.build( faces ) );
+    REQUIRE( expected.build( nbVtx, faces, edges ) );
+    THEN( "The mesh is valid and identical to the one built from its edges" ) {
+      REQUIRE( mesh.isValid() );
+      REQUIRE( mesh.Euler() == 1 );
+      REQUIRE( nbDifferences( mesh, expected ) == 0 );
+    }
+  }
+  GIVEN( "Three triangles sharing an edge" ) {
+    std::vector< Triangle > triangles( 3 );
+    triangles[0].v = { 0, 1, 2 };
+    triangles[1].v = { 2, 1, 3 };
+    triangles[2].v = { 1, 2, 4 };
+    HalfEdgeDataStructure mesh;
+    THEN( "The build fails" ) {
+      REQUIRE( ! mesh.build( triangles ) );
+    }
+  }
+}
+
 SCENARIO( "HalfEdgeDataStructure neighboring relations", "[halfedge][neighbors]" ){
   GIVEN( "Two triangles incident by an edge" ) {
     HalfEdgeDataStructure mesh = makeTwoTriangles();